@@ -0,0 +1,170 @@
+#include "src/SqliteManager.h"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/*
+    ExecStmt(StmtHandle, const StmtBindParameterInfo*, uint32_t, StepCallbackFunc*)가 호출마다 힙 할당을 하지 않는지 검사
+    전역 operator new를 교체해서 할당 횟수를 세고, 준비 단계 이후의 반복 실행에서 할당이 한 번이라도 있으면 실패 (종료 코드 1)
+    SQLite 내부 할당(sqlite3_malloc)은 세지 않음
+*/
+
+const uint32_t kWarmUpIterationNumber = 10;
+const uint32_t kMeasureIterationNumber = 1000;
+
+static std::atomic<uint64_t> g_allocationCount(0);
+
+void* operator new(size_t size)
+{
+    void* memory = nullptr;
+
+    g_allocationCount++;
+
+    memory = std::malloc((size == 0) ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+int main(void)
+{
+    EzSqlite::Errors sqliteErrors = EzSqlite::Errors::kUnsuccess;
+    EzSqlite::SqliteManager sqliteManager;
+    std::vector<std::string> createTableStmtStringList = { "CREATE TABLE ALLOCATION_TB (C_EUID INTEGER, C_TimeStamp INTEGER, ED_Path TEXT);" };
+
+    EzSqlite::StmtHandle insertStmtHandle;
+    EzSqlite::StmtHandle selectStmtHandle;
+    std::array<EzSqlite::StmtBindParameterInfo, 3> stmtBindParameterInfoList;
+
+    int64_t euid = 0;
+    uint64_t timeStamp = 0;
+    const char path[] = "C:\\Windows\\System32\\kernel32.dll";
+    uint64_t selectedRowCount = 0;
+
+    uint64_t insertAllocationCount = 0;
+    uint64_t selectAllocationCount = 0;
+    uint64_t beginAllocationCount = 0;
+
+    EzSqlite::StepCallbackFunc stepCallback = [&](const EzSqlite::StmtInfo&)->EzSqlite::CallbackErrors
+    {
+        selectedRowCount++;
+        return EzSqlite::CallbackErrors::kContinue;
+    };
+
+    sqliteErrors = sqliteManager.CreateDatabase(
+        L"AllocationTest.db",
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        {},
+        &createTableStmtStringList
+    );
+    if (sqliteErrors != EzSqlite::Errors::kSuccess)
+    {
+        printf("CreateDatabase failed (%d)\n", static_cast<int>(sqliteErrors));
+        return 1;
+    }
+
+    sqliteManager.PrepareStmt("INSERT INTO ALLOCATION_TB VALUES (?, ?, ?);", SQLITE_PREPARE_PERSISTENT, &insertStmtHandle);
+    sqliteManager.PrepareStmt("SELECT C_EUID, C_TimeStamp, ED_Path FROM ALLOCATION_TB WHERE C_EUID = ?;", SQLITE_PREPARE_PERSISTENT, &selectStmtHandle);
+
+    stmtBindParameterInfoList[0].data = &euid;
+    stmtBindParameterInfoList[0].dataType = EzSqlite::StmtDataType::kInteger;
+    stmtBindParameterInfoList[0].dataByteSize = sizeof(euid);
+    stmtBindParameterInfoList[0].options = EzSqlite::StmtBindParameterOptions::kSigned;
+    stmtBindParameterInfoList[1].data = &timeStamp;
+    stmtBindParameterInfoList[1].dataType = EzSqlite::StmtDataType::kInteger;
+    stmtBindParameterInfoList[1].dataByteSize = sizeof(timeStamp);
+    stmtBindParameterInfoList[1].options = EzSqlite::StmtBindParameterOptions::kUnsigned;
+    stmtBindParameterInfoList[2].data = path;
+    stmtBindParameterInfoList[2].dataType = EzSqlite::StmtDataType::kText;
+    stmtBindParameterInfoList[2].dataByteSize = sizeof(path) - 1;
+    stmtBindParameterInfoList[2].options = EzSqlite::StmtBindParameterOptions::kDestructorStatic;
+
+    sqliteManager.BeginTransaction();
+
+    // 준비 단계: SQLite 페이지 캐시, 명령문 초기화 등 처음 한 번만 발생하는 할당
+    for (uint32_t iteration = 0; iteration < kWarmUpIterationNumber; iteration++)
+    {
+        euid = iteration;
+        timeStamp = 131890523976951191 + iteration;
+
+        if ((sqliteManager.ExecStmt(insertStmtHandle, stmtBindParameterInfoList.data(), 3) != EzSqlite::Errors::kSuccess) ||
+            (sqliteManager.ExecStmt(selectStmtHandle, stmtBindParameterInfoList.data(), 1, &stepCallback) != EzSqlite::Errors::kSuccess))
+        {
+            printf("warm-up ExecStmt failed\n");
+            return 1;
+        }
+    }
+
+    for (uint32_t iteration = kWarmUpIterationNumber; iteration < kWarmUpIterationNumber + kMeasureIterationNumber; iteration++)
+    {
+        euid = iteration;
+        timeStamp = 131890523976951191 + iteration;
+
+        beginAllocationCount = g_allocationCount;
+        sqliteErrors = sqliteManager.ExecStmt(insertStmtHandle, stmtBindParameterInfoList.data(), 3);
+        insertAllocationCount += g_allocationCount - beginAllocationCount;
+        if (sqliteErrors != EzSqlite::Errors::kSuccess)
+        {
+            printf("INSERT ExecStmt failed (%d)\n", static_cast<int>(sqliteErrors));
+            return 1;
+        }
+
+        beginAllocationCount = g_allocationCount;
+        sqliteErrors = sqliteManager.ExecStmt(selectStmtHandle, stmtBindParameterInfoList.data(), 1, &stepCallback);
+        selectAllocationCount += g_allocationCount - beginAllocationCount;
+        if (sqliteErrors != EzSqlite::Errors::kSuccess)
+        {
+            printf("SELECT ExecStmt failed (%d)\n", static_cast<int>(sqliteErrors));
+            return 1;
+        }
+    }
+
+    sqliteManager.CommitTransaction();
+    sqliteManager.CloseDatabase();
+
+    printf("INSERT: %llu allocations in %u calls\n", static_cast<unsigned long long>(insertAllocationCount), kMeasureIterationNumber);
+    printf("SELECT: %llu allocations in %u calls (%llu rows)\n", static_cast<unsigned long long>(selectAllocationCount), kMeasureIterationNumber, static_cast<unsigned long long>(selectedRowCount));
+
+    if ((insertAllocationCount != 0) || (selectAllocationCount != 0) || (selectedRowCount != kWarmUpIterationNumber + kMeasureIterationNumber))
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,409 @@
+#pragma once
+
+#include "src/SqliteManager.h"
+
+#include <string>
+#include <vector>
+
+/*
+    벤치마크 프로그램 공용 이벤트 스키마 (main.cpp와 같은 7개 이벤트 테이블)
+    테이블 생성문, 테이블 검사 목록, 테이블별 행 구조체와 BulkInsert용 TableMapping, 행 생성 함수 제공
+    행 값은 행 번호로만 결정되므로 같은 행 번호로 만든 행은 실행마다 같음
+*/
+
+const uint32_t kEventTableNumber = 7;
+const uint32_t kFillEventChunkRowCount = 65536;     // InsertEvents가 한 번에 만드는 행 수 (행 전체를 메모리에 만들지 않음)
+
+const std::string kCommonColumnsName = "C_EUID, C_TimeStamp, C_Task, C_Opcode, C_ProcessId, C_ProcessId_PUID, C_ThreadId, C_ThreadId_TUID";
+const std::string kCommonColumnsDefinition = "C_EUID INTEGER, C_TimeStamp INTEGER, C_Task INTEGER, C_Opcode INTEGER, C_ProcessId INTEGER, C_ProcessId_PUID INTEGER, C_ThreadId INTEGER, C_ThreadId_TUID INTEGER";
+
+const std::string kFileIoEventTableName = "FILEIOEVENT_TB";
+const std::string kFileIoEventColumnsName = "ED_TTid, ED_TTid_TUID, ED_OpenPath, ED_OriginalPath";
+const std::string kFileIoEventColumnsDefinition = "ED_TTid INTEGER, ED_TTid_TUID INTEGER, ED_OpenPath TEXT, ED_OriginalPath TEXT";
+
+const std::string kProcessEventTableName = "PROCESSEVENT_TB";
+const std::string kProcessEventColumnsName = "ED_ProcessId, ED_ProcessId_PUID, ED_ParentId, ED_ParentId_PUID, ED_SessionId, ED_ImageFileName, ED_CommandLine";
+const std::string kProcessEventColumnsDefinition = "ED_ProcessId INTEGER, ED_ProcessId_PUID INTEGER, ED_ParentId INTEGER, ED_ParentId_PUID INTEGER, ED_SessionId INTEGER, ED_ImageFileName TEXT, ED_CommandLine TEXT";
+
+const std::string kImageEventTableName = "IMAGEEVENT_TB";
+const std::string kImageEventColumnsName = "ED_ImageBase, ED_ImageSize, ED_ProcessId, ED_ProcessId_PUID, ED_FileName";
+const std::string kImageEventColumnsDefinition = "ED_ImageBase INTEGER, ED_ImageSize INTEGER, ED_ProcessId INTEGER, ED_ProcessId_PUID INTEGER, ED_FileName TEXT";
+
+const std::string kThreadEventTableName = "THREADEVENT_TB";
+const std::string kThreadEventColumnsName = "ED_ProcessId, ED_ProcessId_PUID, ED_TThreadId, ED_TThreadId_TUID, ED_Win32StartAddr";
+const std::string kThreadEventColumnsDefinition = "ED_ProcessId INTEGER, ED_ProcessId_PUID INTEGER, ED_TThreadId INTEGER, ED_TThreadId_TUID INTEGER, ED_Win32StartAddr INTEGER";
+
+const std::string kRegistryEventTableName = "REGISTRYEVENT_TB";
+const std::string kRegistryEventColumnsName = "ED_Status, ED_KeyPath, ED_ValueName, ED_Artifact";
+const std::string kRegistryEventColumnsDefinition = "ED_Status INTEGER, ED_KeyPath TEXT, ED_ValueName TEXT, ED_Artifact TEXT";
+
+// TCPIPEVENT_TB, UDPIPEVENT_TB는 컬럼이 같음
+const std::string kTcpEventTableName = "TCPIPEVENT_TB";
+const std::string kUdpEventTableName = "UDPIPEVENT_TB";
+const std::string kNetworkEventColumnsName = "ED_PID, ED_PID_PUID, ED_size, ED_AccrueSize, ED_TrafficCount, ED_daddr, ED_saddr, ED_dport, ED_sport";
+const std::string kNetworkEventColumnsDefinition = "ED_PID INTEGER, ED_PID_PUID INTEGER, ED_size INTEGER, ED_AccrueSize INTEGER, ED_TrafficCount INTEGER, ED_daddr TEXT, ED_saddr TEXT, ED_dport INTEGER, ED_sport INTEGER";
+
+const std::string kEventTableNameList[kEventTableNumber] =
+{
+    kFileIoEventTableName,
+    kProcessEventTableName,
+    kImageEventTableName,
+    kThreadEventTableName,
+    kRegistryEventTableName,
+    kTcpEventTableName,
+    kUdpEventTableName
+};
+
+const std::vector<std::string> kCreateEventTableStmtStringList =
+{
+    "CREATE TABLE " + kFileIoEventTableName + " (" + kCommonColumnsDefinition + ", " + kFileIoEventColumnsDefinition + ");",
+    "CREATE TABLE " + kProcessEventTableName + " (" + kCommonColumnsDefinition + ", " + kProcessEventColumnsDefinition + ");",
+    "CREATE TABLE " + kImageEventTableName + " (" + kCommonColumnsDefinition + ", " + kImageEventColumnsDefinition + ");",
+    "CREATE TABLE " + kThreadEventTableName + " (" + kCommonColumnsDefinition + ", " + kThreadEventColumnsDefinition + ");",
+    "CREATE TABLE " + kRegistryEventTableName + " (" + kCommonColumnsDefinition + ", " + kRegistryEventColumnsDefinition + ");",
+    "CREATE TABLE " + kTcpEventTableName + " (" + kCommonColumnsDefinition + ", " + kNetworkEventColumnsDefinition + ");",
+    "CREATE TABLE " + kUdpEventTableName + " (" + kCommonColumnsDefinition + ", " + kNetworkEventColumnsDefinition + ");"
+};
+
+// CreateDatabase 테이블 검사 목록 (main.cpp의 kCheckTableStmtStringList와 같은 컬럼)
+const std::vector<std::string> kCheckEventTableStmtStringList =
+{
+    "SELECT " + kCommonColumnsName + ", " + kFileIoEventColumnsName + " FROM " + kFileIoEventTableName + ";",
+    "SELECT " + kCommonColumnsName + ", " + kProcessEventColumnsName + " FROM " + kProcessEventTableName + ";",
+    "SELECT " + kCommonColumnsName + ", " + kImageEventColumnsName + " FROM " + kImageEventTableName + ";",
+    "SELECT " + kCommonColumnsName + ", " + kThreadEventColumnsName + " FROM " + kThreadEventTableName + ";",
+    "SELECT " + kCommonColumnsName + ", " + kRegistryEventColumnsName + " FROM " + kRegistryEventTableName + ";",
+    "SELECT " + kCommonColumnsName + ", " + kNetworkEventColumnsName + " FROM " + kTcpEventTableName + ";",
+    "SELECT " + kCommonColumnsName + ", " + kNetworkEventColumnsName + " FROM " + kUdpEventTableName + ";"
+};
+
+//
+// 테이블별 행 구조체 (멤버 순서는 컬럼 순서와 같음, 공통 컬럼 멤버 이름은 모든 구조체에서 같음)
+//
+
+struct FileIoEvent
+{
+    int64_t euid;
+    int64_t timeStamp;
+    int64_t task;
+    int64_t opcode;
+    int64_t processId;
+    int64_t processPuid;
+    int64_t threadId;
+    int64_t threadTuid;
+
+    int64_t targetThreadId;
+    int64_t targetThreadTuid;
+    std::string openPath;
+    std::string originalPath;
+};
+
+struct ProcessEvent
+{
+    int64_t euid;
+    int64_t timeStamp;
+    int64_t task;
+    int64_t opcode;
+    int64_t processId;
+    int64_t processPuid;
+    int64_t threadId;
+    int64_t threadTuid;
+
+    int64_t eventProcessId;
+    int64_t eventProcessPuid;
+    int64_t parentId;
+    int64_t parentPuid;
+    int64_t sessionId;
+    std::string imageFileName;
+    std::string commandLine;
+};
+
+struct ImageEvent
+{
+    int64_t euid;
+    int64_t timeStamp;
+    int64_t task;
+    int64_t opcode;
+    int64_t processId;
+    int64_t processPuid;
+    int64_t threadId;
+    int64_t threadTuid;
+
+    int64_t imageBase;
+    int64_t imageSize;
+    int64_t eventProcessId;
+    int64_t eventProcessPuid;
+    std::string fileName;
+};
+
+struct ThreadEvent
+{
+    int64_t euid;
+    int64_t timeStamp;
+    int64_t task;
+    int64_t opcode;
+    int64_t processId;
+    int64_t processPuid;
+    int64_t threadId;
+    int64_t threadTuid;
+
+    int64_t eventProcessId;
+    int64_t eventProcessPuid;
+    int64_t targetThreadId;
+    int64_t targetThreadTuid;
+    int64_t win32StartAddr;
+};
+
+struct RegistryEvent
+{
+    int64_t euid;
+    int64_t timeStamp;
+    int64_t task;
+    int64_t opcode;
+    int64_t processId;
+    int64_t processPuid;
+    int64_t threadId;
+    int64_t threadTuid;
+
+    int64_t status;
+    std::string keyPath;
+    std::string valueName;
+    std::string artifact;
+};
+
+// TCPIPEVENT_TB, UDPIPEVENT_TB
+struct NetworkEvent
+{
+    int64_t euid;
+    int64_t timeStamp;
+    int64_t task;
+    int64_t opcode;
+    int64_t processId;
+    int64_t processPuid;
+    int64_t threadId;
+    int64_t threadTuid;
+
+    int64_t pid;
+    int64_t pidPuid;
+    int64_t size;
+    int64_t accrueSize;
+    int64_t trafficCount;
+    std::string destinationAddress;
+    std::string sourceAddress;
+    int64_t destinationPort;
+    int64_t sourcePort;
+};
+
+//
+// 테이블별 TableMapping (공통 컬럼 뒤에 테이블 컬럼)
+//
+
+template <typename Event, typename... Members>
+auto MakeEventTableMapping(
+    _In_ const std::string& tableName,
+    _In_ const EzSqlite::ColumnMapping<Event, Members>&... eventColumnMappings
+)
+{
+    return EzSqlite::MakeTableMapping<Event>(
+        tableName,
+        EzSqlite::MapColumn("C_EUID", &Event::euid),
+        EzSqlite::MapColumn("C_TimeStamp", &Event::timeStamp),
+        EzSqlite::MapColumn("C_Task", &Event::task),
+        EzSqlite::MapColumn("C_Opcode", &Event::opcode),
+        EzSqlite::MapColumn("C_ProcessId", &Event::processId),
+        EzSqlite::MapColumn("C_ProcessId_PUID", &Event::processPuid),
+        EzSqlite::MapColumn("C_ThreadId", &Event::threadId),
+        EzSqlite::MapColumn("C_ThreadId_TUID", &Event::threadTuid),
+        eventColumnMappings...
+    );
+}
+
+inline auto MakeFileIoEventTableMapping()
+{
+    return MakeEventTableMapping<FileIoEvent>(
+        kFileIoEventTableName,
+        EzSqlite::MapColumn("ED_TTid", &FileIoEvent::targetThreadId),
+        EzSqlite::MapColumn("ED_TTid_TUID", &FileIoEvent::targetThreadTuid),
+        EzSqlite::MapColumn("ED_OpenPath", &FileIoEvent::openPath),
+        EzSqlite::MapColumn("ED_OriginalPath", &FileIoEvent::originalPath)
+    );
+}
+
+inline auto MakeProcessEventTableMapping()
+{
+    return MakeEventTableMapping<ProcessEvent>(
+        kProcessEventTableName,
+        EzSqlite::MapColumn("ED_ProcessId", &ProcessEvent::eventProcessId),
+        EzSqlite::MapColumn("ED_ProcessId_PUID", &ProcessEvent::eventProcessPuid),
+        EzSqlite::MapColumn("ED_ParentId", &ProcessEvent::parentId),
+        EzSqlite::MapColumn("ED_ParentId_PUID", &ProcessEvent::parentPuid),
+        EzSqlite::MapColumn("ED_SessionId", &ProcessEvent::sessionId),
+        EzSqlite::MapColumn("ED_ImageFileName", &ProcessEvent::imageFileName),
+        EzSqlite::MapColumn("ED_CommandLine", &ProcessEvent::commandLine)
+    );
+}
+
+inline auto MakeImageEventTableMapping()
+{
+    return MakeEventTableMapping<ImageEvent>(
+        kImageEventTableName,
+        EzSqlite::MapColumn("ED_ImageBase", &ImageEvent::imageBase),
+        EzSqlite::MapColumn("ED_ImageSize", &ImageEvent::imageSize),
+        EzSqlite::MapColumn("ED_ProcessId", &ImageEvent::eventProcessId),
+        EzSqlite::MapColumn("ED_ProcessId_PUID", &ImageEvent::eventProcessPuid),
+        EzSqlite::MapColumn("ED_FileName", &ImageEvent::fileName)
+    );
+}
+
+inline auto MakeThreadEventTableMapping()
+{
+    return MakeEventTableMapping<ThreadEvent>(
+        kThreadEventTableName,
+        EzSqlite::MapColumn("ED_ProcessId", &ThreadEvent::eventProcessId),
+        EzSqlite::MapColumn("ED_ProcessId_PUID", &ThreadEvent::eventProcessPuid),
+        EzSqlite::MapColumn("ED_TThreadId", &ThreadEvent::targetThreadId),
+        EzSqlite::MapColumn("ED_TThreadId_TUID", &ThreadEvent::targetThreadTuid),
+        EzSqlite::MapColumn("ED_Win32StartAddr", &ThreadEvent::win32StartAddr)
+    );
+}
+
+inline auto MakeRegistryEventTableMapping()
+{
+    return MakeEventTableMapping<RegistryEvent>(
+        kRegistryEventTableName,
+        EzSqlite::MapColumn("ED_Status", &RegistryEvent::status),
+        EzSqlite::MapColumn("ED_KeyPath", &RegistryEvent::keyPath),
+        EzSqlite::MapColumn("ED_ValueName", &RegistryEvent::valueName),
+        EzSqlite::MapColumn("ED_Artifact", &RegistryEvent::artifact)
+    );
+}
+
+// tableName: kTcpEventTableName, kUdpEventTableName
+inline auto MakeNetworkEventTableMapping(_In_ const std::string& tableName)
+{
+    return MakeEventTableMapping<NetworkEvent>(
+        tableName,
+        EzSqlite::MapColumn("ED_PID", &NetworkEvent::pid),
+        EzSqlite::MapColumn("ED_PID_PUID", &NetworkEvent::pidPuid),
+        EzSqlite::MapColumn("ED_size", &NetworkEvent::size),
+        EzSqlite::MapColumn("ED_AccrueSize", &NetworkEvent::accrueSize),
+        EzSqlite::MapColumn("ED_TrafficCount", &NetworkEvent::trafficCount),
+        EzSqlite::MapColumn("ED_daddr", &NetworkEvent::destinationAddress),
+        EzSqlite::MapColumn("ED_saddr", &NetworkEvent::sourceAddress),
+        EzSqlite::MapColumn("ED_dport", &NetworkEvent::destinationPort),
+        EzSqlite::MapColumn("ED_sport", &NetworkEvent::sourcePort)
+    );
+}
+
+//
+// 행 생성 (rowIndex번째 행)
+//
+
+template <typename Event>
+void FillCommonEvent(_In_ uint32_t rowIndex, _Out_ Event& event)
+{
+    event.euid = rowIndex;
+    event.timeStamp = 131890523976951191LL + static_cast<int64_t>(rowIndex) * 10000;
+    event.task = rowIndex % 7;
+    event.opcode = rowIndex % 3;
+    event.processId = 4000 + rowIndex % 300;
+    event.processPuid = event.processId * 1000;
+    event.threadId = rowIndex % 5000;
+    event.threadTuid = event.threadId * 77;
+}
+
+inline void FillEvent(_In_ uint32_t rowIndex, _Out_ FileIoEvent& event)
+{
+    FillCommonEvent(rowIndex, event);
+    event.targetThreadId = rowIndex % 4999;
+    event.targetThreadTuid = event.targetThreadId * 77;
+    event.openPath = "C:\\Users\\user\\AppData\\Local\\Temp\\f" + std::to_string(rowIndex) + ".tmp";
+    event.originalPath = "C:\\Users\\user\\Downloads\\f" + std::to_string(rowIndex % 1000) + ".tmp";
+}
+
+inline void FillEvent(_In_ uint32_t rowIndex, _Out_ ProcessEvent& event)
+{
+    FillCommonEvent(rowIndex, event);
+    event.eventProcessId = 8000 + rowIndex % 3000;
+    event.eventProcessPuid = event.eventProcessId * 1000;
+    event.parentId = event.processId;
+    event.parentPuid = event.processPuid;
+    event.sessionId = rowIndex % 4;
+    event.imageFileName = "C:\\Windows\\System32\\process" + std::to_string(rowIndex % 500) + ".exe";
+    event.commandLine = event.imageFileName + " -k netsvcs -p -s " + std::to_string(rowIndex);
+}
+
+inline void FillEvent(_In_ uint32_t rowIndex, _Out_ ImageEvent& event)
+{
+    FillCommonEvent(rowIndex, event);
+    event.imageBase = 0x7FF800000000LL + static_cast<int64_t>(rowIndex % 2000) * 0x100000;
+    event.imageSize = 0x1000 * (1 + rowIndex % 256);
+    event.eventProcessId = event.processId;
+    event.eventProcessPuid = event.processPuid;
+    event.fileName = "C:\\Windows\\System32\\module" + std::to_string(rowIndex % 2000) + ".dll";
+}
+
+inline void FillEvent(_In_ uint32_t rowIndex, _Out_ ThreadEvent& event)
+{
+    FillCommonEvent(rowIndex, event);
+    event.eventProcessId = event.processId;
+    event.eventProcessPuid = event.processPuid;
+    event.targetThreadId = 10000 + rowIndex % 20000;
+    event.targetThreadTuid = event.targetThreadId * 77;
+    event.win32StartAddr = 0x7FF800001000LL + static_cast<int64_t>(rowIndex % 4096) * 0x10;
+}
+
+inline void FillEvent(_In_ uint32_t rowIndex, _Out_ RegistryEvent& event)
+{
+    FillCommonEvent(rowIndex, event);
+    event.status = (rowIndex % 10 == 0) ? 0xC0000034LL : 0;
+    event.keyPath = "HKLM\\SOFTWARE\\Vendor\\Key" + std::to_string(rowIndex % 100);
+    event.valueName = "Value" + std::to_string(rowIndex % 20);
+    event.artifact = "artifact" + std::to_string(rowIndex);
+}
+
+inline void FillEvent(_In_ uint32_t rowIndex, _Out_ NetworkEvent& event)
+{
+    FillCommonEvent(rowIndex, event);
+    event.pid = event.processId;
+    event.pidPuid = event.processPuid;
+    event.size = 64 + rowIndex % 1400;
+    event.accrueSize = event.size * (1 + rowIndex % 16);
+    event.trafficCount = 1 + rowIndex % 16;
+    event.destinationAddress = "10.0." + std::to_string(rowIndex % 16) + "." + std::to_string(rowIndex % 255);
+    event.sourceAddress = "192.168.0." + std::to_string(rowIndex % 255);
+    event.destinationPort = (rowIndex % 2 == 0) ? 443 : 80;
+    event.sourcePort = 49152 + rowIndex % 16384;
+}
+
+// 0 ~ rowCount - 1번째 행을 kFillEventChunkRowCount개씩 만들어서 BulkInsert
+template <typename Event, typename... Members>
+EzSqlite::Errors InsertEvents(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ const EzSqlite::TableMapping<Event, Members...>& tableMapping,
+    _In_ uint32_t rowCount,
+    _In_opt_ const EzSqlite::BulkInsertOptions& bulkInsertOptions = EzSqlite::BulkInsertOptions()
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kSuccess;
+    std::vector<Event> eventList;
+
+    for (uint32_t chunkBeginIndex = 0; chunkBeginIndex < rowCount; chunkBeginIndex += kFillEventChunkRowCount)
+    {
+        uint32_t chunkRowCount = (std::min)(kFillEventChunkRowCount, rowCount - chunkBeginIndex);
+
+        eventList.resize(chunkRowCount);
+        for (uint32_t rowIndex = 0; rowIndex < chunkRowCount; rowIndex++)
+        {
+            FillEvent(chunkBeginIndex + rowIndex, eventList[rowIndex]);
+        }
+
+        retValue = sqliteManager.BulkInsert(tableMapping, eventList, bulkInsertOptions);
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            break;
+        }
+    }
+
+    return retValue;
+}
\ No newline at end of file
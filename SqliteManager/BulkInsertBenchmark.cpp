@@ -0,0 +1,304 @@
+#include "BenchmarkEventSchema.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+    이벤트 테이블 7개에 같은 행을 넣을 때 INSERT 방식별 초당 행 수 측정
+    1. 행마다 StmtBindParameterInfo 배열을 만들어 ExecStmt로 INSERT (기존 방식, kDefaultBulkInsertChunkRowCount 행마다 트랜잭션)
+    2. BulkInsert (valuesRowCount 1, 16, 64, 256, 트랜잭션 크기는 1과 같음)
+    측정마다 행 수를 확인하고 테이블을 비우며, 방식마다 가장 빠른 결과 출력
+
+    Release 빌드로 실행해야 됨, 테이블별 행 수는 첫 번째 인자로 변경 가능 (기본 200,000)
+    INSERT가 실패하거나 테이블의 행 수가 넣은 행 수와 다르면 실패 (종료 코드 1)
+*/
+
+const uint32_t kDefaultRowCount = 200000;
+const uint32_t kRepeatNumber = 3;
+const uint32_t kValuesRowCountList[] = { 1, 16, 64, 256 };
+const uint32_t kValuesRowCountNumber = sizeof(kValuesRowCountList) / sizeof(kValuesRowCountList[0]);
+
+struct InsertResult
+{
+    InsertResult()
+    {
+        execStmtRowsPerSecond = 0;
+        for (auto& bulkInsertRowsPerSecondListEntry : bulkInsertRowsPerSecondList)
+        {
+            bulkInsertRowsPerSecondListEntry = 0;
+        }
+    };
+
+    double execStmtRowsPerSecond;
+    double bulkInsertRowsPerSecondList[kValuesRowCountNumber];
+};
+
+// 이벤트 구조체 멤버는 int64_t, std::string만 사용
+static void SetBindParameterInfo(
+    _In_ const int64_t& value,
+    _Out_ EzSqlite::StmtBindParameterInfo& stmtBindParameterInfo
+)
+{
+    stmtBindParameterInfo.data = &value;
+    stmtBindParameterInfo.dataType = EzSqlite::StmtDataType::kInteger;
+    stmtBindParameterInfo.dataByteSize = sizeof(value);
+    stmtBindParameterInfo.options = EzSqlite::StmtBindParameterOptions::kSigned;
+}
+
+// BulkInsert와 같이 복사하지 않고 Bind (행 구조체는 ExecStmt가 끝날 때까지 유효)
+static void SetBindParameterInfo(
+    _In_ const std::string& value,
+    _Out_ EzSqlite::StmtBindParameterInfo& stmtBindParameterInfo
+)
+{
+    stmtBindParameterInfo.data = value.c_str();
+    stmtBindParameterInfo.dataType = EzSqlite::StmtDataType::kText;
+    stmtBindParameterInfo.dataByteSize = static_cast<uint32_t>(value.length());
+    stmtBindParameterInfo.options = EzSqlite::StmtBindParameterOptions::kDestructorStatic;
+}
+
+template <typename Event, typename... Members, size_t... ColumnIndexes>
+static void SetBindParameterInfoList(
+    _In_ const Event& event,
+    _In_ const std::tuple<Members Event::*...>& memberList,
+    _Out_writes_(sizeof...(Members)) EzSqlite::StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ std::index_sequence<ColumnIndexes...>
+)
+{
+    const int expandList[] = { (SetBindParameterInfo(event.*std::get<ColumnIndexes>(memberList), stmtBindParameterInfoList[ColumnIndexes]), 0)... };
+    (void)expandList;
+}
+
+static EzSqlite::Errors CheckAndClearTable(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ const std::string& tableName,
+    _In_ uint32_t rowCount
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+    int64_t tableRowCount = -1;
+
+    EzSqlite::StepCallbackFunc countCallback = [&](const EzSqlite::StmtInfo& stmtInfo)
+    {
+        tableRowCount = sqlite3_column_int64(stmtInfo.stmt, 0);
+        return EzSqlite::CallbackErrors::kContinue;
+    };
+
+    retValue = sqliteManager.ExecStmt("SELECT count(*) FROM " + tableName + ";", nullptr, &countCallback);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    if (tableRowCount != rowCount)
+    {
+        printf("%s has %lld rows (expected %u)\n", tableName.c_str(), static_cast<long long>(tableRowCount), rowCount);
+        retValue = EzSqlite::Errors::kUnsuccess;
+        return retValue;
+    }
+
+    return sqliteManager.ExecStmt("DELETE FROM " + tableName + ";");
+}
+
+// 행마다 ExecStmt 호출 (기존 방식)
+template <typename Event, typename... Members>
+static EzSqlite::Errors InsertByExecStmt(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ EzSqlite::StmtHandle insertStmtHandle,
+    _In_ const EzSqlite::TableMapping<Event, Members...>& tableMapping,
+    _In_ const std::vector<Event>& eventList
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kSuccess;
+    std::array<EzSqlite::StmtBindParameterInfo, sizeof...(Members)> stmtBindParameterInfoList;
+
+    for (size_t chunkBeginIndex = 0; chunkBeginIndex < eventList.size(); chunkBeginIndex += EzSqlite::kDefaultBulkInsertChunkRowCount)
+    {
+        size_t chunkEndIndex = (std::min)(chunkBeginIndex + EzSqlite::kDefaultBulkInsertChunkRowCount, eventList.size());
+
+        retValue = sqliteManager.BeginTransaction();
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        for (size_t rowIndex = chunkBeginIndex; rowIndex < chunkEndIndex; rowIndex++)
+        {
+            SetBindParameterInfoList(eventList[rowIndex], tableMapping.GetMemberList(), stmtBindParameterInfoList.data(), std::index_sequence_for<Members...>());
+
+            retValue = sqliteManager.ExecStmt(insertStmtHandle, stmtBindParameterInfoList.data(), static_cast<uint32_t>(stmtBindParameterInfoList.size()));
+            if (retValue != EzSqlite::Errors::kSuccess)
+            {
+                sqliteManager.RollbackTransaction();
+                return retValue;
+            }
+        }
+
+        retValue = sqliteManager.CommitTransaction();
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    return retValue;
+}
+
+template <typename Event, typename... Members>
+static EzSqlite::Errors MeasureTable(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ const std::string& tableName,
+    _In_ const EzSqlite::TableMapping<Event, Members...>& tableMapping,
+    _In_ uint32_t rowCount,
+    _Out_ InsertResult& insertResult
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+
+    std::vector<Event> eventList(rowCount);
+    EzSqlite::StmtHandle insertStmtHandle;
+    std::chrono::steady_clock::time_point beginTime;
+    double rowsPerSecond = 0;
+
+    insertResult = InsertResult();
+
+    // 행 생성 비용이 INSERT 시간에 포함되지 않도록 미리 만들어둠
+    for (uint32_t rowIndex = 0; rowIndex < rowCount; rowIndex++)
+    {
+        FillEvent(rowIndex, eventList[rowIndex]);
+    }
+
+    retValue = sqliteManager.PrepareStmt(tableMapping.GetInsertStmtString(), SQLITE_PREPARE_PERSISTENT, &insertStmtHandle);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (uint32_t repeatIndex = 0; repeatIndex < kRepeatNumber; repeatIndex++)
+    {
+        beginTime = std::chrono::steady_clock::now();
+        retValue = InsertByExecStmt(sqliteManager, insertStmtHandle, tableMapping, eventList);
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+        rowsPerSecond = rowCount / std::chrono::duration<double>(std::chrono::steady_clock::now() - beginTime).count();
+        insertResult.execStmtRowsPerSecond = (std::max)(insertResult.execStmtRowsPerSecond, rowsPerSecond);
+
+        retValue = CheckAndClearTable(sqliteManager, tableName, rowCount);
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        for (uint32_t valuesRowCountIndex = 0; valuesRowCountIndex < kValuesRowCountNumber; valuesRowCountIndex++)
+        {
+            EzSqlite::BulkInsertOptions bulkInsertOptions;
+            uint32_t insertedRowCount = 0;
+
+            bulkInsertOptions.valuesRowCount = kValuesRowCountList[valuesRowCountIndex];
+
+            beginTime = std::chrono::steady_clock::now();
+            retValue = sqliteManager.BulkInsert(tableMapping, eventList, bulkInsertOptions, &insertedRowCount);
+            if ((retValue != EzSqlite::Errors::kSuccess) || (insertedRowCount != rowCount))
+            {
+                retValue = EzSqlite::Errors::kUnsuccess;
+                return retValue;
+            }
+            rowsPerSecond = rowCount / std::chrono::duration<double>(std::chrono::steady_clock::now() - beginTime).count();
+            insertResult.bulkInsertRowsPerSecondList[valuesRowCountIndex] = (std::max)(insertResult.bulkInsertRowsPerSecondList[valuesRowCountIndex], rowsPerSecond);
+
+            retValue = CheckAndClearTable(sqliteManager, tableName, rowCount);
+            if (retValue != EzSqlite::Errors::kSuccess)
+            {
+                return retValue;
+            }
+        }
+    }
+
+    return sqliteManager.FinalizePreparedStmt(insertStmtHandle);
+}
+
+template <typename Event, typename... Members>
+static bool MeasureAndPrintTable(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ const std::string& tableName,
+    _In_ const EzSqlite::TableMapping<Event, Members...>& tableMapping,
+    _In_ uint32_t rowCount
+)
+{
+    InsertResult insertResult;
+
+    if (MeasureTable(sqliteManager, tableName, tableMapping, rowCount, insertResult) != EzSqlite::Errors::kSuccess)
+    {
+        printf("FAILED %s\n", tableName.c_str());
+        return false;
+    }
+
+    printf("%-17s %4u   %9.0f", tableName.c_str(), static_cast<uint32_t>(sizeof...(Members)), insertResult.execStmtRowsPerSecond);
+    for (const auto bulkInsertRowsPerSecondListEntry : insertResult.bulkInsertRowsPerSecondList)
+    {
+        printf("   %9.0f", bulkInsertRowsPerSecondListEntry);
+    }
+    printf("\n");
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    EzSqlite::SqliteManager sqliteManager;
+
+    uint32_t rowCount = kDefaultRowCount;
+    bool succeeded = true;
+
+    if (argc > 1)
+    {
+        rowCount = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (rowCount == 0)
+        {
+            rowCount = kDefaultRowCount;
+        }
+    }
+
+    if (sqliteManager.CreateDatabase(
+        L"BulkInsertBenchmark.db",
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        {},
+        &kCreateEventTableStmtStringList) != EzSqlite::Errors::kSuccess)
+    {
+        printf("CreateDatabase failed\n");
+        return 1;
+    }
+
+    printf("%u rows per table, %u rows per transaction, best of %u (rows/s)\n", rowCount, EzSqlite::kDefaultBulkInsertChunkRowCount, kRepeatNumber);
+    printf("table             cols    ExecStmt");
+    for (const auto valuesRowCount : kValuesRowCountList)
+    {
+        printf("   values %3u", valuesRowCount);
+    }
+    printf("\n");
+
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kFileIoEventTableName, MakeFileIoEventTableMapping(), rowCount);
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kProcessEventTableName, MakeProcessEventTableMapping(), rowCount);
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kImageEventTableName, MakeImageEventTableMapping(), rowCount);
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kThreadEventTableName, MakeThreadEventTableMapping(), rowCount);
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kRegistryEventTableName, MakeRegistryEventTableMapping(), rowCount);
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kTcpEventTableName, MakeNetworkEventTableMapping(kTcpEventTableName), rowCount);
+    succeeded = succeeded && MeasureAndPrintTable(sqliteManager, kUdpEventTableName, MakeNetworkEventTableMapping(kUdpEventTableName), rowCount);
+
+    sqliteManager.CloseDatabase(true);
+
+    if (succeeded == false)
+    {
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
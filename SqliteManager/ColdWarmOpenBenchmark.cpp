@@ -0,0 +1,153 @@
+#include "BenchmarkEventSchema.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+    이벤트 테이블 7개 검사 목록으로 CreateDatabase(kOpenExisting)를 반복할 때 열기 시간 측정
+    1. cold open: 열 때마다 ClearSchemaFingerprintCache로 검증 결과 캐시를 비움 (검사 명령문 7개 Prepare)
+    2. warm reopen: 캐시를 그대로 두고 CloseDatabase 후 다시 열기 (스키마 상태만 비교)
+
+    Release 빌드로 실행해야 됨, 열기 횟수는 첫 번째 인자로 변경 가능 (기본 1,000)
+    warm reopen에서 검증 명령문 Prepare가 한 번이라도 있거나 cold open에서 매번 검증하지 않으면 실패 (종료 코드 1)
+*/
+
+const std::wstring kBenchmarkDatabasePath = L"ColdWarmOpenBenchmark.db";
+const uint32_t kDefaultOpenNumber = 1000;
+
+// 열기 반복 후 평균 시간과 그 동안의 검증 횟수 변화
+static EzSqlite::Errors MeasureOpen(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ uint32_t openNumber,
+    _In_ bool clearSchemaFingerprintCache,
+    _Out_ double& openMicroseconds,
+    _Out_ EzSqlite::SchemaVerifyStatistics& schemaVerifyStatistics
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+
+    EzSqlite::SchemaVerifyStatistics beginStatistics;
+    EzSqlite::SchemaVerifyStatistics endStatistics;
+    std::chrono::steady_clock::duration elapsedTime = std::chrono::steady_clock::duration::zero();
+    std::chrono::steady_clock::time_point beginTime;
+
+    openMicroseconds = 0;
+    schemaVerifyStatistics = EzSqlite::SchemaVerifyStatistics();
+
+    EzSqlite::SqliteManager::GetSchemaVerifyStatistics(beginStatistics);
+
+    for (uint32_t openIndex = 0; openIndex < openNumber; openIndex++)
+    {
+        retValue = sqliteManager.CloseDatabase();
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        if (clearSchemaFingerprintCache == true)
+        {
+            EzSqlite::SqliteManager::ClearSchemaFingerprintCache();
+        }
+
+        beginTime = std::chrono::steady_clock::now();
+        retValue = sqliteManager.CreateDatabase(
+            kBenchmarkDatabasePath,
+            EzSqlite::DesiredAccess::kReadWrite,
+            EzSqlite::CreationDisposition::kOpenExisting,
+            nullptr,
+            nullptr,
+            kCheckEventTableStmtStringList);
+        elapsedTime += std::chrono::steady_clock::now() - beginTime;
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    EzSqlite::SqliteManager::GetSchemaVerifyStatistics(endStatistics);
+
+    openMicroseconds = std::chrono::duration<double, std::micro>(elapsedTime).count() / openNumber;
+    schemaVerifyStatistics.verifyCount = endStatistics.verifyCount - beginStatistics.verifyCount;
+    schemaVerifyStatistics.cacheHitCount = endStatistics.cacheHitCount - beginStatistics.cacheHitCount;
+    schemaVerifyStatistics.verifyPrepareCount = endStatistics.verifyPrepareCount - beginStatistics.verifyPrepareCount;
+
+    return retValue;
+}
+
+int main(int argc, char* argv[])
+{
+    EzSqlite::SqliteManager sqliteManager;
+    EzSqlite::SchemaVerifyStatistics coldStatistics;
+    EzSqlite::SchemaVerifyStatistics warmStatistics;
+
+    uint32_t openNumber = kDefaultOpenNumber;
+    double coldOpenMicroseconds = 0;
+    double warmOpenMicroseconds = 0;
+
+    if (argc > 1)
+    {
+        openNumber = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (openNumber == 0)
+        {
+            openNumber = kDefaultOpenNumber;
+        }
+    }
+
+    if (sqliteManager.CreateDatabase(
+        kBenchmarkDatabasePath,
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        kCheckEventTableStmtStringList,
+        &kCreateEventTableStmtStringList) != EzSqlite::Errors::kSuccess)
+    {
+        printf("CreateDatabase failed\n");
+        return 1;
+    }
+
+    if (MeasureOpen(sqliteManager, openNumber, true, coldOpenMicroseconds, coldStatistics) != EzSqlite::Errors::kSuccess)
+    {
+        printf("FAILED cold open\n");
+        return 1;
+    }
+
+    // 마지막 cold open이 남긴 캐시로 warm reopen 측정
+    if (MeasureOpen(sqliteManager, openNumber, false, warmOpenMicroseconds, warmStatistics) != EzSqlite::Errors::kSuccess)
+    {
+        printf("FAILED warm reopen\n");
+        return 1;
+    }
+
+    sqliteManager.CloseDatabase(true);
+
+    printf("%u opens, %u verify statements\n", openNumber, static_cast<uint32_t>(kCheckEventTableStmtStringList.size()));
+    printf("                 open time    verify   cache hit   verify prepare\n");
+    printf("cold open      %8.1f us   %7llu   %9llu   %14llu\n",
+        coldOpenMicroseconds,
+        static_cast<unsigned long long>(coldStatistics.verifyCount),
+        static_cast<unsigned long long>(coldStatistics.cacheHitCount),
+        static_cast<unsigned long long>(coldStatistics.verifyPrepareCount));
+    printf("warm reopen    %8.1f us   %7llu   %9llu   %14llu\n",
+        warmOpenMicroseconds,
+        static_cast<unsigned long long>(warmStatistics.verifyCount),
+        static_cast<unsigned long long>(warmStatistics.cacheHitCount),
+        static_cast<unsigned long long>(warmStatistics.verifyPrepareCount));
+
+    if ((coldStatistics.cacheHitCount != 0) ||
+        (coldStatistics.verifyPrepareCount != static_cast<uint64_t>(openNumber) * kCheckEventTableStmtStringList.size()))
+    {
+        printf("FAILED cold open did not verify every table\n");
+        return 1;
+    }
+
+    if ((warmStatistics.verifyPrepareCount != 0) || (warmStatistics.cacheHitCount != openNumber))
+    {
+        printf("FAILED warm reopen prepared verify statements\n");
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
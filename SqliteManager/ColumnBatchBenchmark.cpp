@@ -0,0 +1,283 @@
+#include "BenchmarkEventSchema.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+    TCPIPEVENT_TB, UDPIPEVENT_TB의 ED_size, ED_AccrueSize, ED_daddr, ED_dport 집계 시간 측정
+    1. Step 콜백에서 행마다 값을 읽어 배열에 다시 담은 뒤 배열 단위로 집계 (기존 방식)
+    2. ResultCursor::FetchColumnBatch로 컬럼 버퍼를 채운 뒤 같은 배열 단위 집계
+    두 방식 모두 kBatchRowCount 행마다 같은 Aggregate 함수를 호출하므로 차이는 행을 배열로 옮기는 비용
+
+    Release 빌드로 실행해야 됨, 테이블별 행 수는 첫 번째 인자로 변경 가능 (기본 500,000)
+    두 방식의 집계 결과가 다르면 실패 (종료 코드 1)
+*/
+
+const uint32_t kDefaultRowCount = 500000;
+const uint32_t kBatchRowCount = 1024;
+const uint32_t kRepeatNumber = 5;
+const int64_t kHttpsPort = 443;
+
+struct NetworkAggregate
+{
+    NetworkAggregate()
+    {
+        rowCount = 0;
+        sizeSum = 0;
+        accrueSizeSum = 0;
+        httpsRowCount = 0;
+        addressByteSize = 0;
+    };
+
+    bool operator==(_In_ const NetworkAggregate& networkAggregate) const
+    {
+        return (rowCount == networkAggregate.rowCount) &&
+            (sizeSum == networkAggregate.sizeSum) &&
+            (accrueSizeSum == networkAggregate.accrueSizeSum) &&
+            (httpsRowCount == networkAggregate.httpsRowCount) &&
+            (addressByteSize == networkAggregate.addressByteSize);
+    }
+
+    uint64_t rowCount;
+    int64_t sizeSum;
+    int64_t accrueSizeSum;
+    uint64_t httpsRowCount;
+    uint64_t addressByteSize;
+};
+
+// 연속 메모리 배열에 대한 집계 (두 방식 공통)
+static void Aggregate(
+    _In_reads_(rowCount) const int64_t* sizeList,
+    _In_reads_(rowCount) const int64_t* accrueSizeList,
+    _In_reads_(rowCount) const int64_t* portList,
+    _In_reads_(rowCount + 1) const uint32_t* addressOffsetList,
+    _In_ uint32_t rowCount,
+    _Inout_ NetworkAggregate& networkAggregate
+)
+{
+    for (uint32_t rowIndex = 0; rowIndex < rowCount; rowIndex++)
+    {
+        networkAggregate.sizeSum += sizeList[rowIndex];
+        networkAggregate.accrueSizeSum += accrueSizeList[rowIndex];
+        networkAggregate.httpsRowCount += (portList[rowIndex] == kHttpsPort) ? 1 : 0;
+    }
+
+    networkAggregate.rowCount += rowCount;
+    networkAggregate.addressByteSize += addressOffsetList[rowCount] - addressOffsetList[0];
+}
+
+// Step 콜백으로 한 행씩 읽어서 배열에 담은 뒤 집계
+static EzSqlite::Errors AggregateByStepCallback(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ EzSqlite::StmtHandle aggregateStmtHandle,
+    _Inout_ NetworkAggregate& networkAggregate
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+
+    std::vector<int64_t> sizeList;
+    std::vector<int64_t> accrueSizeList;
+    std::vector<int64_t> portList;
+    std::vector<uint32_t> addressOffsetList(1, 0);
+    std::vector<std::string::traits_type::char_type> addressArena;
+
+    sizeList.reserve(kBatchRowCount);
+    accrueSizeList.reserve(kBatchRowCount);
+    portList.reserve(kBatchRowCount);
+    addressOffsetList.reserve(kBatchRowCount + 1);
+
+    auto flushBatch = [&]
+    {
+        Aggregate(sizeList.data(), accrueSizeList.data(), portList.data(), addressOffsetList.data(), static_cast<uint32_t>(sizeList.size()), networkAggregate);
+
+        sizeList.clear();
+        accrueSizeList.clear();
+        portList.clear();
+        addressOffsetList.resize(1);
+        addressArena.clear();
+    };
+
+    retValue = sqliteManager.ExecStmt(aggregateStmtHandle, nullptr, 0, [&](const EzSqlite::StmtInfo& stmtInfo)
+        {
+            const unsigned char* address = sqlite3_column_text(stmtInfo.stmt, 2);
+            int addressByteSize = sqlite3_column_bytes(stmtInfo.stmt, 2);
+
+            sizeList.push_back(sqlite3_column_int64(stmtInfo.stmt, 0));
+            accrueSizeList.push_back(sqlite3_column_int64(stmtInfo.stmt, 1));
+            portList.push_back(sqlite3_column_int64(stmtInfo.stmt, 3));
+            addressArena.insert(addressArena.end(), address, address + addressByteSize);
+            addressOffsetList.push_back(static_cast<uint32_t>(addressArena.size()));
+
+            if (sizeList.size() == kBatchRowCount)
+            {
+                flushBatch();
+            }
+
+            return EzSqlite::CallbackErrors::kContinue;
+        });
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    if (sizeList.empty() == false)
+    {
+        flushBatch();
+    }
+
+    return retValue;
+}
+
+// FetchColumnBatch로 채운 컬럼 버퍼를 그대로 집계
+static EzSqlite::Errors AggregateByColumnBatch(
+    _Inout_ EzSqlite::SqliteManager& sqliteManager,
+    _In_ EzSqlite::StmtHandle aggregateStmtHandle,
+    _Inout_ std::vector<EzSqlite::ColumnBuffer>& columnBufferList,
+    _Inout_ NetworkAggregate& networkAggregate
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+    EzSqlite::ResultCursor resultCursor = sqliteManager.Query(aggregateStmtHandle);
+    uint32_t fetchedRowCount = 0;
+
+    while ((retValue = resultCursor.FetchColumnBatch(kBatchRowCount, columnBufferList, fetchedRowCount)) == EzSqlite::Errors::kSuccess)
+    {
+        Aggregate(
+            columnBufferList[0].integerList.data(),
+            columnBufferList[1].integerList.data(),
+            columnBufferList[3].integerList.data(),
+            columnBufferList[2].offsetList.data(),
+            fetchedRowCount,
+            networkAggregate);
+    }
+
+    // 모두 읽으면 kNoResult
+    if (retValue == EzSqlite::Errors::kNoResult)
+    {
+        retValue = EzSqlite::Errors::kSuccess;
+    }
+
+    return retValue;
+}
+
+int main(int argc, char* argv[])
+{
+    EzSqlite::SqliteManager sqliteManager;
+    std::vector<EzSqlite::StmtHandle> aggregateStmtHandleList;
+    std::vector<EzSqlite::ColumnBuffer> columnBufferList =
+    {
+        EzSqlite::ColumnBuffer(0, EzSqlite::StmtDataType::kInteger),
+        EzSqlite::ColumnBuffer(1, EzSqlite::StmtDataType::kInteger),
+        EzSqlite::ColumnBuffer(2, EzSqlite::StmtDataType::kText),
+        EzSqlite::ColumnBuffer(3, EzSqlite::StmtDataType::kInteger)
+    };
+
+    uint32_t rowCount = kDefaultRowCount;
+    double stepCallbackMilliseconds = 0;
+    double columnBatchMilliseconds = 0;
+    NetworkAggregate stepCallbackAggregate;
+    NetworkAggregate columnBatchAggregate;
+
+    if (argc > 1)
+    {
+        rowCount = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (rowCount == 0)
+        {
+            rowCount = kDefaultRowCount;
+        }
+    }
+
+    if (sqliteManager.CreateDatabase(
+        L"ColumnBatchBenchmark.db",
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        {},
+        &kCreateEventTableStmtStringList) != EzSqlite::Errors::kSuccess)
+    {
+        printf("CreateDatabase failed\n");
+        return 1;
+    }
+
+    for (const auto& tableName : { kTcpEventTableName, kUdpEventTableName })
+    {
+        EzSqlite::StmtHandle aggregateStmtHandle;
+
+        if (InsertEvents(sqliteManager, MakeNetworkEventTableMapping(tableName), rowCount) != EzSqlite::Errors::kSuccess)
+        {
+            printf("InsertEvents failed (%s)\n", tableName.c_str());
+            return 1;
+        }
+
+        if (sqliteManager.PrepareStmt("SELECT ED_size, ED_AccrueSize, ED_daddr, ED_dport FROM " + tableName + ";", SQLITE_PREPARE_PERSISTENT, &aggregateStmtHandle) != EzSqlite::Errors::kSuccess)
+        {
+            printf("PrepareStmt failed (%s)\n", tableName.c_str());
+            return 1;
+        }
+        aggregateStmtHandleList.push_back(aggregateStmtHandle);
+    }
+
+    for (uint32_t repeatIndex = 0; repeatIndex < kRepeatNumber; repeatIndex++)
+    {
+        NetworkAggregate networkAggregate;
+        std::chrono::steady_clock::time_point beginTime;
+        double elapsedMilliseconds = 0;
+
+        beginTime = std::chrono::steady_clock::now();
+        for (const auto aggregateStmtHandle : aggregateStmtHandleList)
+        {
+            if (AggregateByStepCallback(sqliteManager, aggregateStmtHandle, networkAggregate) != EzSqlite::Errors::kSuccess)
+            {
+                printf("FAILED AggregateByStepCallback\n");
+                return 1;
+            }
+        }
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count();
+        if ((repeatIndex == 0) || (elapsedMilliseconds < stepCallbackMilliseconds))
+        {
+            stepCallbackMilliseconds = elapsedMilliseconds;
+        }
+        stepCallbackAggregate = networkAggregate;
+
+        networkAggregate = NetworkAggregate();
+        beginTime = std::chrono::steady_clock::now();
+        for (const auto aggregateStmtHandle : aggregateStmtHandleList)
+        {
+            if (AggregateByColumnBatch(sqliteManager, aggregateStmtHandle, columnBufferList, networkAggregate) != EzSqlite::Errors::kSuccess)
+            {
+                printf("FAILED AggregateByColumnBatch\n");
+                return 1;
+            }
+        }
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count();
+        if ((repeatIndex == 0) || (elapsedMilliseconds < columnBatchMilliseconds))
+        {
+            columnBatchMilliseconds = elapsedMilliseconds;
+        }
+        columnBatchAggregate = networkAggregate;
+    }
+
+    sqliteManager.CloseDatabase(true);
+
+    printf("%u rows per table, %u rows per batch, best of %u\n", rowCount, kBatchRowCount, kRepeatNumber);
+    printf("step callback      %8.1f ms   %6.1f ns/row\n", stepCallbackMilliseconds, stepCallbackMilliseconds * 1000000 / (2.0 * rowCount));
+    printf("FetchColumnBatch   %8.1f ms   %6.1f ns/row\n", columnBatchMilliseconds, columnBatchMilliseconds * 1000000 / (2.0 * rowCount));
+    printf("sum(ED_size) %lld, sum(ED_AccrueSize) %lld, ED_dport = %lld rows %llu\n",
+        static_cast<long long>(columnBatchAggregate.sizeSum),
+        static_cast<long long>(columnBatchAggregate.accrueSizeSum),
+        static_cast<long long>(kHttpsPort),
+        static_cast<unsigned long long>(columnBatchAggregate.httpsRowCount));
+
+    if ((stepCallbackAggregate.rowCount != 2ULL * rowCount) || ((stepCallbackAggregate == columnBatchAggregate) == false))
+    {
+        printf("FAILED aggregates differ (rows %llu / %llu)\n",
+            static_cast<unsigned long long>(stepCallbackAggregate.rowCount),
+            static_cast<unsigned long long>(columnBatchAggregate.rowCount));
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
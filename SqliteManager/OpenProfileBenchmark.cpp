@@ -0,0 +1,191 @@
+#include "BenchmarkEventSchema.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+    OpenProfile(kNone, kIngest, kAnalytics, kLowMemory)별 PROCESSEVENT_TB 수집 처리량과 전체 조회 시간 측정
+    프로파일마다 Database를 새로 만들고 미리 만들어둔 행을 BulkInsert(기본 BulkInsertOptions)로 넣은 뒤 집계 조회를 반복
+    수집은 초당 INSERT 행 수, 조회는 가장 빠른 시간 출력
+
+    Release 빌드로 실행해야 됨, 행 수는 첫 번째 인자로 변경 가능 (기본 300,000)
+    INSERT나 조회가 실패하거나 프로파일별 조회 결과가 다르면 실패 (종료 코드 1)
+*/
+
+const std::wstring kBenchmarkDatabasePath = L"OpenProfileBenchmark.db";
+const uint32_t kDefaultRowCount = 300000;
+const uint32_t kRepeatNumber = 5;
+
+const std::string kScanStmtString = "SELECT count(*), sum(ED_SessionId), sum(length(ED_ImageFileName)), sum(length(ED_CommandLine)) FROM " + kProcessEventTableName + ";";
+
+struct OpenProfileName
+{
+    EzSqlite::OpenProfile openProfile;
+    const char* name;
+};
+
+const OpenProfileName kOpenProfileNameList[] =
+{
+    { EzSqlite::OpenProfile::kNone, "none" },
+    { EzSqlite::OpenProfile::kIngest, "ingest" },
+    { EzSqlite::OpenProfile::kAnalytics, "analytics" },
+    { EzSqlite::OpenProfile::kLowMemory, "low-memory" }
+};
+
+struct ProfileResult
+{
+    ProfileResult()
+    {
+        ingestSeconds = 0;
+        scanMilliseconds = 0;
+        scanRowCount = 0;
+        checksum = 0;
+    };
+
+    double ingestSeconds;
+    double scanMilliseconds;
+    int64_t scanRowCount;
+    int64_t checksum;
+};
+
+static EzSqlite::Errors MeasureOpenProfile(
+    _In_ EzSqlite::OpenProfile openProfile,
+    _In_ const std::vector<ProcessEvent>& processEventList,
+    _Out_ ProfileResult& profileResult
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+
+    EzSqlite::SqliteManager sqliteManager;
+    EzSqlite::OpenOptions openOptions(openProfile);
+    EzSqlite::StmtHandle scanStmtHandle;
+    std::chrono::steady_clock::time_point beginTime;
+    double elapsedMilliseconds = 0;
+
+    profileResult = ProfileResult();
+
+    auto raii = EzSqlite::RAIIRegister([&]
+        {
+            sqliteManager.CloseDatabase(true);
+        });
+
+    retValue = sqliteManager.CreateDatabase(
+        kBenchmarkDatabasePath,
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        {},
+        &kCreateEventTableStmtStringList,
+        &openOptions);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    beginTime = std::chrono::steady_clock::now();
+    retValue = sqliteManager.BulkInsert(MakeProcessEventTableMapping(), processEventList);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+    profileResult.ingestSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginTime).count();
+
+    retValue = sqliteManager.PrepareStmt(kScanStmtString, SQLITE_PREPARE_PERSISTENT, &scanStmtHandle);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (uint32_t repeatIndex = 0; repeatIndex < kRepeatNumber; repeatIndex++)
+    {
+        beginTime = std::chrono::steady_clock::now();
+        retValue = sqliteManager.ExecStmt(scanStmtHandle, nullptr, 0, [&](const EzSqlite::StmtInfo& stmtInfo)
+            {
+                profileResult.scanRowCount = sqlite3_column_int64(stmtInfo.stmt, 0);
+                profileResult.checksum = sqlite3_column_int64(stmtInfo.stmt, 1) + sqlite3_column_int64(stmtInfo.stmt, 2) + sqlite3_column_int64(stmtInfo.stmt, 3);
+                return EzSqlite::CallbackErrors::kContinue;
+            });
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count();
+
+        if ((repeatIndex == 0) || (elapsedMilliseconds < profileResult.scanMilliseconds))
+        {
+            profileResult.scanMilliseconds = elapsedMilliseconds;
+        }
+    }
+
+    return retValue;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<ProcessEvent> processEventList;
+
+    uint32_t rowCount = kDefaultRowCount;
+    int64_t baseChecksum = 0;
+    bool failed = false;
+
+    if (argc > 1)
+    {
+        rowCount = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (rowCount == 0)
+        {
+            rowCount = kDefaultRowCount;
+        }
+    }
+
+    // 행 생성 비용이 수집 시간에 포함되지 않도록 미리 만들어둠
+    processEventList.resize(rowCount);
+    for (uint32_t rowIndex = 0; rowIndex < rowCount; rowIndex++)
+    {
+        FillEvent(rowIndex, processEventList[rowIndex]);
+    }
+
+    printf("%u rows, scan best of %u\n", rowCount, kRepeatNumber);
+    printf("profile       ingest rows/s   scan ms\n");
+
+    for (const auto& openProfileNameListEntry : kOpenProfileNameList)
+    {
+        ProfileResult profileResult;
+
+        if (MeasureOpenProfile(openProfileNameListEntry.openProfile, processEventList, profileResult) != EzSqlite::Errors::kSuccess)
+        {
+            printf("FAILED %s\n", openProfileNameListEntry.name);
+            return 1;
+        }
+
+        printf("%-10s    %13.0f   %7.1f\n",
+            openProfileNameListEntry.name,
+            rowCount / profileResult.ingestSeconds,
+            profileResult.scanMilliseconds);
+
+        if (openProfileNameListEntry.openProfile == EzSqlite::OpenProfile::kNone)
+        {
+            baseChecksum = profileResult.checksum;
+        }
+
+        if ((profileResult.scanRowCount != rowCount) || (profileResult.checksum != baseChecksum))
+        {
+            printf("FAILED %s rows %lld, checksum %lld / %lld\n",
+                openProfileNameListEntry.name,
+                static_cast<long long>(profileResult.scanRowCount),
+                static_cast<long long>(profileResult.checksum),
+                static_cast<long long>(baseChecksum));
+            failed = true;
+        }
+    }
+
+    if (failed == true)
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "src/SqliteManager.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/*
+    등록된 명령문 수(10, 100, 1000)에 따른 SqliteManager::FindPreparedStmt(const std::string&) 검색 시간 측정
+    이전 구현(등록 순서대로 strcmp)과 같은 선형 검색을 비교 기준으로 함께 측정
+    명령문은 앞부분이 길게 같고 끝의 상수만 다르므로 strcmp 비교 비용이 큰 경우에 해당
+
+    Release 빌드로 실행해야 됨, 검색 횟수는 첫 번째 인자로 변경 가능
+    검색 결과가 등록한 명령문과 다르면 실패 (종료 코드 1)
+*/
+
+const uint32_t kDefaultLookupNumber = 1000000;
+const uint32_t kRegisteredStmtNumberList[] = { 10, 100, 1000 };
+
+const std::string kLookupStmtPrefix = "SELECT C_EUID, C_TimeStamp, C_Task, C_Opcode, C_ProcessId, C_ProcessId_PUID, C_ThreadId, C_ThreadId_TUID FROM LOOKUP_TB WHERE C_TimeStamp >= ? AND C_TimeStamp <= ? AND C_EUID = ";
+
+// 이전 FindPreparedStmt 구현과 같은 선형 검색
+static const std::string* FindStmtStringByScan(
+    _In_ const std::vector<std::string>& stmtStringList,
+    _In_ const std::string& stmtString
+)
+{
+    for (const auto& stmtStringListEntry : stmtStringList)
+    {
+        if (strcmp(stmtStringListEntry.c_str(), stmtString.c_str()) == 0)
+        {
+            return &stmtStringListEntry;
+        }
+    }
+
+    return nullptr;
+}
+
+int main(int argc, char* argv[])
+{
+    EzSqlite::SqliteManager sqliteManager;
+    std::vector<std::string> createTableStmtStringList = { "CREATE TABLE LOOKUP_TB (C_EUID INTEGER, C_TimeStamp INTEGER, C_Task INTEGER, C_Opcode INTEGER, C_ProcessId INTEGER, C_ProcessId_PUID INTEGER, C_ThreadId INTEGER, C_ThreadId_TUID INTEGER);" };
+
+    uint32_t lookupNumber = kDefaultLookupNumber;
+    uint64_t checksum = 0;
+
+    if (argc > 1)
+    {
+        lookupNumber = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (lookupNumber == 0)
+        {
+            lookupNumber = kDefaultLookupNumber;
+        }
+    }
+
+    if (sqliteManager.CreateDatabase(
+        L"PreparedStmtLookupBenchmark.db",
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        {},
+        &createTableStmtStringList) != EzSqlite::Errors::kSuccess)
+    {
+        printf("CreateDatabase failed\n");
+        return 1;
+    }
+
+    printf("registered   FindPreparedStmt   linear strcmp\n");
+
+    for (const auto registeredStmtNumber : kRegisteredStmtNumberList)
+    {
+        std::vector<std::string> stmtStringList;
+        const EzSqlite::StmtInfo* stmtInfo = nullptr;
+        std::chrono::steady_clock::time_point beginTime;
+        double findNanoseconds = 0;
+        double scanNanoseconds = 0;
+
+        sqliteManager.ClearPreparedStmt();
+
+        for (uint32_t stmtIndex = 0; stmtIndex < registeredStmtNumber; stmtIndex++)
+        {
+            stmtStringList.push_back(kLookupStmtPrefix + std::to_string(stmtIndex) + ";");
+            if (sqliteManager.PrepareStmt(stmtStringList.back()) != EzSqlite::Errors::kSuccess)
+            {
+                printf("PrepareStmt failed (%s)\n", stmtStringList.back().c_str());
+                return 1;
+            }
+        }
+
+        // 호출자 버퍼 그대로 검색 (임시 문자열 생성 없음)
+        beginTime = std::chrono::steady_clock::now();
+        for (uint32_t lookupIndex = 0; lookupIndex < lookupNumber; lookupIndex++)
+        {
+            const std::string& stmtString = stmtStringList[lookupIndex % registeredStmtNumber];
+
+            if ((sqliteManager.FindPreparedStmt(stmtString, stmtInfo) != EzSqlite::Errors::kSuccess) ||
+                (stmtInfo->stmtString.size() != stmtString.size()))
+            {
+                printf("FAILED FindPreparedStmt (%s)\n", stmtString.c_str());
+                return 1;
+            }
+            checksum += stmtInfo->bindParameterCount;
+        }
+        findNanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - beginTime).count() / lookupNumber;
+
+        beginTime = std::chrono::steady_clock::now();
+        for (uint32_t lookupIndex = 0; lookupIndex < lookupNumber; lookupIndex++)
+        {
+            const std::string* foundStmtString = FindStmtStringByScan(stmtStringList, stmtStringList[lookupIndex % registeredStmtNumber]);
+            if (foundStmtString == nullptr)
+            {
+                printf("FAILED linear scan\n");
+                return 1;
+            }
+            checksum += foundStmtString->size();
+        }
+        scanNanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - beginTime).count() / lookupNumber;
+
+        printf("%10u   %13.1f ns   %10.1f ns\n", registeredStmtNumber, findNanoseconds, scanNanoseconds);
+    }
+
+    sqliteManager.CloseDatabase(true);
+
+    // checksum을 출력해서 반복문이 최적화로 제거되지 않도록 함
+    printf("checksum %llu\n", static_cast<unsigned long long>(checksum));
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
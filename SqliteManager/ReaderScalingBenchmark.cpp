@@ -0,0 +1,273 @@
+#include "src/ConnectionPool.h"
+#include "src/BatchWriter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+/*
+    ConnectionPool 읽기 연결 수에 따른 조회 처리량 측정 (수집 스레드가 BatchWriter로 계속 INSERT하는 동안)
+    읽기 연결 수를 1, 2, 4, ...로 늘리면서 단계마다 읽기 연결 수만큼의 조회 스레드를 실행하고 초당 조회 수, 초당 INSERT 행 수 출력
+    WAL 모드에서는 조회가 쓰기를 막지 않으므로 코어 수까지는 조회 처리량이 늘고 INSERT 처리량은 유지되어야 됨
+
+    인자: [단계별 측정 시간(초), 기본 5] [최대 읽기 연결 수, 기본 CPU 코어 수]
+    Release 빌드로 실행해야 됨, 조회나 INSERT가 한 번이라도 실패하면 종료 코드 1
+*/
+
+const std::wstring kBenchmarkDatabasePath = L"ReaderScalingBenchmark.db";
+const uint32_t kPreloadRowCount = 200000;
+const uint32_t kQueryRangeRowCount = 10000;
+const uint32_t kDefaultMeasureSeconds = 5;
+const char kBenchmarkPath[] = "C:\\Windows\\System32\\kernel32.dll";
+
+struct ScalingResult
+{
+    ScalingResult()
+    {
+        queryCount = 0;
+        insertedRowCount = 0;
+        failedCount = 0;
+        elapsedSeconds = 0;
+    };
+
+    uint64_t queryCount;
+    uint64_t insertedRowCount;
+    uint64_t failedCount;
+    double elapsedSeconds;
+};
+
+static EzSqlite::Errors OpenBenchmarkPool(
+    _Inout_ EzSqlite::ConnectionPool& connectionPool,
+    _In_ uint32_t readerCount,
+    _Out_ EzSqlite::PoolStmtHandle& insertPoolStmtHandle,
+    _Out_ EzSqlite::PoolStmtHandle& queryPoolStmtHandle
+)
+{
+    EzSqlite::Errors retValue = EzSqlite::Errors::kUnsuccess;
+
+    std::vector<std::string> createTableStmtStringList = { "CREATE TABLE EVENT_TB (C_EUID INTEGER, C_TimeStamp INTEGER, ED_Path TEXT);" };
+    EzSqlite::StmtHandle insertStmtHandle;
+
+    retValue = connectionPool.Open(kBenchmarkDatabasePath, EzSqlite::CreationDisposition::kCreateAlways, readerCount, nullptr, nullptr, {}, &createTableStmtStringList);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = connectionPool.PrepareStmt("INSERT INTO EVENT_TB VALUES (?, ?, ?);", SQLITE_PREPARE_PERSISTENT, insertPoolStmtHandle);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = connectionPool.PrepareStmt("SELECT count(*), sum(length(ED_Path)) FROM EVENT_TB WHERE C_TimeStamp BETWEEN ? AND ?;", SQLITE_PREPARE_PERSISTENT, queryPoolStmtHandle);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    // 조회 범위를 인덱스로 찾도록 미리 채워둠
+    EzSqlite::ConnectionLease writerLease = connectionPool.AcquireWriter();
+
+    retValue = writerLease->ExecStmt(std::string("CREATE INDEX EVENT_TB_C_TimeStamp ON EVENT_TB (C_TimeStamp);"));
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = writerLease.GetStmtHandle(insertPoolStmtHandle, insertStmtHandle);
+    if (retValue != EzSqlite::Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    EzSqlite::BatchWriter batchWriter(*writerLease);
+    for (uint32_t rowIndex = 0; rowIndex < kPreloadRowCount; rowIndex++)
+    {
+        retValue = batchWriter.InsertWithParameters(insertStmtHandle, static_cast<int64_t>(rowIndex), static_cast<int64_t>(rowIndex), kBenchmarkPath);
+        if (retValue != EzSqlite::Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    return batchWriter.Flush();
+}
+
+static bool MeasureReaderScaling(
+    _In_ uint32_t readerCount,
+    _In_ uint32_t measureSeconds,
+    _Out_ ScalingResult& scalingResult
+)
+{
+    EzSqlite::ConnectionPool connectionPool;
+    EzSqlite::PoolStmtHandle insertPoolStmtHandle;
+    EzSqlite::PoolStmtHandle queryPoolStmtHandle;
+
+    std::atomic<bool> stopped(false);
+    std::atomic<uint64_t> queryCount(0);
+    std::atomic<uint64_t> insertedRowCount(0);
+    std::atomic<uint64_t> failedCount(0);
+    std::thread ingestThread;
+    std::vector<std::thread> queryThreadList;
+    std::chrono::steady_clock::time_point beginTime;
+
+    scalingResult = ScalingResult();
+
+    if (OpenBenchmarkPool(connectionPool, readerCount, insertPoolStmtHandle, queryPoolStmtHandle) != EzSqlite::Errors::kSuccess)
+    {
+        printf("OpenBenchmarkPool failed (readers %u)\n", readerCount);
+        return false;
+    }
+
+    beginTime = std::chrono::steady_clock::now();
+
+    // 수집: 쓰기 연결 하나에서 기본 BatchWriterOptions로 계속 INSERT
+    ingestThread = std::thread([&]
+        {
+            EzSqlite::ConnectionLease writerLease = connectionPool.AcquireWriter();
+            EzSqlite::StmtHandle insertStmtHandle;
+            int64_t rowIndex = kPreloadRowCount;
+
+            if (writerLease.GetStmtHandle(insertPoolStmtHandle, insertStmtHandle) != EzSqlite::Errors::kSuccess)
+            {
+                failedCount++;
+                return;
+            }
+
+            EzSqlite::BatchWriter batchWriter(*writerLease);
+            while (stopped == false)
+            {
+                if (batchWriter.InsertWithParameters(insertStmtHandle, rowIndex, rowIndex, kBenchmarkPath) != EzSqlite::Errors::kSuccess)
+                {
+                    failedCount++;
+                    continue;
+                }
+
+                rowIndex++;
+                insertedRowCount++;
+            }
+
+            if (batchWriter.Flush() != EzSqlite::Errors::kSuccess)
+            {
+                failedCount++;
+            }
+        });
+
+    // 조회: 읽기 연결 수만큼의 스레드가 미리 채워둔 범위 안에서 임의의 구간을 집계
+    for (uint32_t threadIndex = 0; threadIndex < readerCount; threadIndex++)
+    {
+        queryThreadList.emplace_back([&, threadIndex]
+            {
+                std::minstd_rand random(threadIndex + 1);
+                std::uniform_int_distribution<int64_t> rangeDistribution(0, kPreloadRowCount - kQueryRangeRowCount);
+                int64_t rangeBegin = 0;
+                int64_t selectedRowCount = 0;
+
+                auto stepCallback = [&](const EzSqlite::StmtInfo& stmtInfo)->EzSqlite::CallbackErrors
+                {
+                    selectedRowCount = sqlite3_column_int64(stmtInfo.stmt, 0);
+                    return EzSqlite::CallbackErrors::kContinue;
+                };
+
+                while (stopped == false)
+                {
+                    rangeBegin = rangeDistribution(random);
+                    selectedRowCount = 0;
+
+                    if ((connectionPool.ExecQuery(queryPoolStmtHandle, stepCallback, rangeBegin, rangeBegin + kQueryRangeRowCount - 1) != EzSqlite::Errors::kSuccess) ||
+                        (selectedRowCount != kQueryRangeRowCount))
+                    {
+                        failedCount++;
+                        continue;
+                    }
+
+                    queryCount++;
+                }
+            });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(measureSeconds));
+    stopped = true;
+
+    for (auto& queryThreadListEntry : queryThreadList)
+    {
+        queryThreadListEntry.join();
+    }
+    ingestThread.join();
+
+    scalingResult.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - beginTime).count();
+    scalingResult.queryCount = queryCount;
+    scalingResult.insertedRowCount = insertedRowCount;
+    scalingResult.failedCount = failedCount;
+
+    if (connectionPool.Close() != EzSqlite::Errors::kSuccess)
+    {
+        printf("ConnectionPool::Close failed (readers %u)\n", readerCount);
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t measureSeconds = kDefaultMeasureSeconds;
+    uint32_t maxReaderCount = (std::max)(std::thread::hardware_concurrency(), 1U);
+    double baseQueryPerSecond = 0;
+    bool failed = false;
+
+    if (argc > 1)
+    {
+        measureSeconds = (std::max)(static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)), 1U);
+    }
+    if (argc > 2)
+    {
+        maxReaderCount = (std::max)(static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)), 1U);
+    }
+
+    printf("cores %u, %u seconds per step, %u preloaded rows, %u rows per query\n",
+        std::thread::hardware_concurrency(), measureSeconds, kPreloadRowCount, kQueryRangeRowCount);
+    printf("readers   queries/s   speedup   inserted rows/s   failed\n");
+
+    for (uint32_t readerCount = 1; readerCount <= maxReaderCount; readerCount *= 2)
+    {
+        ScalingResult scalingResult;
+        double queryPerSecond = 0;
+
+        if (MeasureReaderScaling(readerCount, measureSeconds, scalingResult) == false)
+        {
+            return 1;
+        }
+
+        queryPerSecond = scalingResult.queryCount / scalingResult.elapsedSeconds;
+        if (readerCount == 1)
+        {
+            baseQueryPerSecond = queryPerSecond;
+        }
+
+        printf("%7u   %9.0f   %6.2fx   %15.0f   %6llu\n",
+            readerCount,
+            queryPerSecond,
+            (baseQueryPerSecond > 0) ? (queryPerSecond / baseQueryPerSecond) : 0.0,
+            scalingResult.insertedRowCount / scalingResult.elapsedSeconds,
+            static_cast<unsigned long long>(scalingResult.failedCount));
+
+        if ((scalingResult.failedCount != 0) || (scalingResult.queryCount == 0) || (scalingResult.insertedRowCount == 0))
+        {
+            failed = true;
+        }
+    }
+
+    if (failed == true)
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "BenchmarkEventSchema.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+    PROCESSEVENT_TB 전체 조회 시 Step 콜백 호출 방식별 시간 측정
+    같은 명령문을 람다 그대로 받는 ExecStmt 템플릿 오버로드와 StepCallbackFunc(std::function) 오버로드로 번갈아 실행하고 가장 빠른 시간 출력
+    콜백은 행마다 정수 컬럼 2개와 텍스트 길이를 더함 (행당 처리량이 작을수록 호출 방식 차이가 크게 보임)
+
+    Release 빌드로 실행해야 됨, 행 수는 첫 번째 인자로 변경 가능 (기본 1,000,000)
+    두 방식의 행 수나 합계가 다르면 실패 (종료 코드 1)
+*/
+
+const uint32_t kDefaultRowCount = 1000000;
+const uint32_t kRepeatNumber = 5;
+
+const std::string kScanStmtString = "SELECT ED_ProcessId, ED_SessionId, ED_ImageFileName FROM " + kProcessEventTableName + ";";
+
+struct ScanResult
+{
+    ScanResult()
+    {
+        rowCount = 0;
+        checksum = 0;
+    };
+
+    uint64_t rowCount;
+    int64_t checksum;
+};
+
+static EzSqlite::CallbackErrors AccumulateRow(
+    _In_ const EzSqlite::StmtInfo& stmtInfo,
+    _Inout_ ScanResult& scanResult
+)
+{
+    scanResult.rowCount++;
+    scanResult.checksum += sqlite3_column_int64(stmtInfo.stmt, 0);
+    scanResult.checksum += sqlite3_column_int64(stmtInfo.stmt, 1);
+    scanResult.checksum += sqlite3_column_bytes(stmtInfo.stmt, 2);
+
+    return EzSqlite::CallbackErrors::kContinue;
+}
+
+int main(int argc, char* argv[])
+{
+    EzSqlite::SqliteManager sqliteManager;
+    EzSqlite::StmtHandle scanStmtHandle;
+
+    uint32_t rowCount = kDefaultRowCount;
+    double lambdaMilliseconds = 0;
+    double stepCallbackFuncMilliseconds = 0;
+    ScanResult lambdaScanResult;
+    ScanResult stepCallbackFuncScanResult;
+
+    if (argc > 1)
+    {
+        rowCount = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (rowCount == 0)
+        {
+            rowCount = kDefaultRowCount;
+        }
+    }
+
+    if (sqliteManager.CreateDatabase(
+        L"StepCallbackBenchmark.db",
+        EzSqlite::DesiredAccess::kReadWrite,
+        EzSqlite::CreationDisposition::kCreateAlways,
+        nullptr,
+        nullptr,
+        {},
+        &kCreateEventTableStmtStringList) != EzSqlite::Errors::kSuccess)
+    {
+        printf("CreateDatabase failed\n");
+        return 1;
+    }
+
+    if (InsertEvents(sqliteManager, MakeProcessEventTableMapping(), rowCount) != EzSqlite::Errors::kSuccess)
+    {
+        printf("InsertEvents failed\n");
+        return 1;
+    }
+
+    if (sqliteManager.PrepareStmt(kScanStmtString, SQLITE_PREPARE_PERSISTENT, &scanStmtHandle) != EzSqlite::Errors::kSuccess)
+    {
+        printf("PrepareStmt failed\n");
+        return 1;
+    }
+
+    for (uint32_t repeatIndex = 0; repeatIndex < kRepeatNumber; repeatIndex++)
+    {
+        ScanResult scanResult;
+        std::chrono::steady_clock::time_point beginTime;
+        double elapsedMilliseconds = 0;
+
+        // 람다를 그대로 전달 (Step 루프에 인라인)
+        beginTime = std::chrono::steady_clock::now();
+        if (sqliteManager.ExecStmt(scanStmtHandle, nullptr, 0, [&](const EzSqlite::StmtInfo& stmtInfo)
+            {
+                return AccumulateRow(stmtInfo, scanResult);
+            }) != EzSqlite::Errors::kSuccess)
+        {
+            printf("FAILED ExecStmt (lambda)\n");
+            return 1;
+        }
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count();
+        if ((repeatIndex == 0) || (elapsedMilliseconds < lambdaMilliseconds))
+        {
+            lambdaMilliseconds = elapsedMilliseconds;
+        }
+        lambdaScanResult = scanResult;
+
+        // 같은 람다를 StepCallbackFunc로 감싸서 전달 (행마다 std::function 간접 호출)
+        scanResult = ScanResult();
+        EzSqlite::StepCallbackFunc stepCallback = [&](const EzSqlite::StmtInfo& stmtInfo)
+        {
+            return AccumulateRow(stmtInfo, scanResult);
+        };
+
+        beginTime = std::chrono::steady_clock::now();
+        if (sqliteManager.ExecStmt(scanStmtHandle, nullptr, 0, &stepCallback) != EzSqlite::Errors::kSuccess)
+        {
+            printf("FAILED ExecStmt (StepCallbackFunc)\n");
+            return 1;
+        }
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count();
+        if ((repeatIndex == 0) || (elapsedMilliseconds < stepCallbackFuncMilliseconds))
+        {
+            stepCallbackFuncMilliseconds = elapsedMilliseconds;
+        }
+        stepCallbackFuncScanResult = scanResult;
+    }
+
+    sqliteManager.CloseDatabase(true);
+
+    printf("%u rows, best of %u\n", rowCount, kRepeatNumber);
+    printf("lambda             %8.1f ms   %6.1f ns/row\n", lambdaMilliseconds, lambdaMilliseconds * 1000000 / rowCount);
+    printf("StepCallbackFunc   %8.1f ms   %6.1f ns/row\n", stepCallbackFuncMilliseconds, stepCallbackFuncMilliseconds * 1000000 / rowCount);
+
+    if ((lambdaScanResult.rowCount != rowCount) ||
+        (stepCallbackFuncScanResult.rowCount != rowCount) ||
+        (lambdaScanResult.checksum != stepCallbackFuncScanResult.checksum))
+    {
+        printf("FAILED rows %llu / %llu, checksum %lld / %lld\n",
+            static_cast<unsigned long long>(lambdaScanResult.rowCount),
+            static_cast<unsigned long long>(stepCallbackFuncScanResult.rowCount),
+            static_cast<long long>(lambdaScanResult.checksum),
+            static_cast<long long>(stepCallbackFuncScanResult.checksum));
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "src/SqliteManager.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+/*
+    SqliteManager::GetStmtType과 이전 구현(키워드 접두어를 순서대로 _strnicmp로 비교)의 명령문당 분류 시간 비교
+    Release 빌드로 실행해야 됨, 반복 횟수는 첫 번째 인자로 변경 가능
+    두 구현의 결과가 다르면 실패 (종료 코드 1)
+*/
+
+const uint32_t kDefaultIterationNumber = 2000000;
+
+const char* const kBenchmarkStmtStringList[] =
+{
+    "SELECT C_EUID, C_TimeStamp, ED_Path FROM A_TB WHERE C_EUID = ?;",
+    "INSERT INTO A_TB VALUES (?, ?, ?);",
+    "UPDATE A_TB SET ED_Path = ? WHERE C_EUID = ?;",
+    "DELETE FROM A_TB WHERE C_TimeStamp < ?;",
+    "VACUUM;",
+    "PRAGMA user_version;",
+    "CREATE TEMPORARY TABLE A_TEMP (C_EUID INTEGER);",
+    "ROLLBACK;",
+};
+
+// 이전 GetStmtType_ 구현
+static EzSqlite::StmtType GetStmtTypeByPrefix(
+    _In_ const std::string::traits_type::char_type* stmtString
+)
+{
+    uint32_t stmtStringLength = static_cast<uint32_t>(strlen(stmtString));
+
+    if ((strlen("ALTER TABLE") <= stmtStringLength) && (_strnicmp("ALTER TABLE", stmtString, strlen("ALTER TABLE")) == 0))
+    {
+        return EzSqlite::StmtType::kAlterTable;
+    }
+    else if ((strlen("ANALYZE") <= stmtStringLength) && (_strnicmp("ANALYZE", stmtString, strlen("ANALYZE")) == 0))
+    {
+        return EzSqlite::StmtType::kAnalyze;
+    }
+    else if ((strlen("ATTACH") <= stmtStringLength) && (_strnicmp("ATTACH", stmtString, strlen("ATTACH")) == 0))
+    {
+        return EzSqlite::StmtType::kAttach;
+    }
+    else if ((strlen("BEGIN") <= stmtStringLength) && (_strnicmp("BEGIN", stmtString, strlen("BEGIN")) == 0))
+    {
+        return EzSqlite::StmtType::kBegin;
+    }
+    else if ((strlen("COMMIT") <= stmtStringLength) && (_strnicmp("COMMIT", stmtString, strlen("COMMIT")) == 0))
+    {
+        return EzSqlite::StmtType::kCommit;
+    }
+    else if (((strlen("CREATE INDEX") <= stmtStringLength) && (_strnicmp("CREATE INDEX", stmtString, strlen("CREATE INDEX")) == 0)) ||
+        ((strlen("CREATE UNIQUE INDEX") <= stmtStringLength) && (_strnicmp("CREATE UNIQUE INDEX", stmtString, strlen("CREATE UNIQUE INDEX")) == 0)))
+    {
+        return EzSqlite::StmtType::kCreateIndex;
+    }
+    else if (((strlen("CREATE TABLE") <= stmtStringLength) && (_strnicmp("CREATE TABLE", stmtString, strlen("CREATE TABLE")) == 0)) ||
+        ((strlen("CREATE TEMP TABLE") <= stmtStringLength) && (_strnicmp("CREATE TEMP TABLE", stmtString, strlen("CREATE TEMP TABLE")) == 0)) ||
+        ((strlen("CREATE TEMPORARY TABLE") <= stmtStringLength) && (_strnicmp("CREATE TEMPORARY TABLE", stmtString, strlen("CREATE TEMPORARY TABLE")) == 0)))
+    {
+        return EzSqlite::StmtType::kCreateTable;
+    }
+    else if (((strlen("CREATE TRIGGER") <= stmtStringLength) && (_strnicmp("CREATE TRIGGER", stmtString, strlen("CREATE TRIGGER")) == 0)) ||
+        ((strlen("CREATE TEMP TRIGGER") <= stmtStringLength) && (_strnicmp("CREATE TEMP TRIGGER", stmtString, strlen("CREATE TEMP TRIGGER")) == 0)) ||
+        ((strlen("CREATE TEMPORARY TRIGGER") <= stmtStringLength) && (_strnicmp("CREATE TEMPORARY TRIGGER", stmtString, strlen("CREATE TEMPORARY TRIGGER")) == 0)))
+    {
+        return EzSqlite::StmtType::kCreateTrigger;
+    }
+    else if (((strlen("CREATE VIEW") <= stmtStringLength) && (_strnicmp("CREATE VIEW", stmtString, strlen("CREATE VIEW")) == 0)) ||
+        ((strlen("CREATE TEMP VIEW") <= stmtStringLength) && (_strnicmp("CREATE TEMP VIEW", stmtString, strlen("CREATE TEMP VIEW")) == 0)) ||
+        ((strlen("CREATE TEMPORARY VIEW") <= stmtStringLength) && (_strnicmp("CREATE TEMPORARY VIEW", stmtString, strlen("CREATE TEMPORARY VIEW")) == 0)))
+    {
+        return EzSqlite::StmtType::kCreateView;
+    }
+    else if ((strlen("CREATE VIRTUAL TABLE") <= stmtStringLength) && (_strnicmp("CREATE VIRTUAL TABLE", stmtString, strlen("CREATE VIRTUAL TABLE")) == 0))
+    {
+        return EzSqlite::StmtType::kCreateVirtualTable;
+    }
+    else if ((strlen("DELETE FROM") <= stmtStringLength) && (_strnicmp("DELETE FROM", stmtString, strlen("DELETE FROM")) == 0))
+    {
+        return EzSqlite::StmtType::kDelete;
+    }
+    else if ((strlen("DETACH") <= stmtStringLength) && (_strnicmp("DETACH", stmtString, strlen("DETACH")) == 0))
+    {
+        return EzSqlite::StmtType::kDetach;
+    }
+    else if ((strlen("DROP INDEX") <= stmtStringLength) && (_strnicmp("DROP INDEX", stmtString, strlen("DROP INDEX")) == 0))
+    {
+        return EzSqlite::StmtType::kDropIndex;
+    }
+    else if ((strlen("DROP TABLE") <= stmtStringLength) && (_strnicmp("DROP TABLE", stmtString, strlen("DROP TABLE")) == 0))
+    {
+        return EzSqlite::StmtType::kDropTable;
+    }
+    else if ((strlen("DROP TRIGGER") <= stmtStringLength) && (_strnicmp("DROP TRIGGER", stmtString, strlen("DROP TRIGGER")) == 0))
+    {
+        return EzSqlite::StmtType::kDropTrigger;
+    }
+    else if ((strlen("DROP VIEW") <= stmtStringLength) && (_strnicmp("DROP VIEW", stmtString, strlen("DROP VIEW")) == 0))
+    {
+        return EzSqlite::StmtType::kDropView;
+    }
+    else if ((strlen("INSERT INTO") <= stmtStringLength) && (_strnicmp("INSERT INTO", stmtString, strlen("INSERT INTO")) == 0))
+    {
+        return EzSqlite::StmtType::kInsert;
+    }
+    else if ((strlen("PRAGMA") <= stmtStringLength) && (_strnicmp("PRAGMA", stmtString, strlen("PRAGMA")) == 0))
+    {
+        return EzSqlite::StmtType::kPragma;
+    }
+    else if ((strlen("REINDEX") <= stmtStringLength) && (_strnicmp("REINDEX", stmtString, strlen("REINDEX")) == 0))
+    {
+        return EzSqlite::StmtType::kReindex;
+    }
+    else if ((strlen("RELEASE") <= stmtStringLength) && (_strnicmp("RELEASE", stmtString, strlen("RELEASE")) == 0))
+    {
+        return EzSqlite::StmtType::kRelease;
+    }
+    else if ((strlen("ROLLBACK") <= stmtStringLength) && (_strnicmp("ROLLBACK", stmtString, strlen("ROLLBACK")) == 0))
+    {
+        return EzSqlite::StmtType::kRollback;
+    }
+    else if ((strlen("SAVEPOINT") <= stmtStringLength) && (_strnicmp("SAVEPOINT", stmtString, strlen("SAVEPOINT")) == 0))
+    {
+        return EzSqlite::StmtType::kSavepoint;
+    }
+    else if ((strlen("SELECT") <= stmtStringLength) && (_strnicmp("SELECT", stmtString, strlen("SELECT")) == 0))
+    {
+        return EzSqlite::StmtType::kSelect;
+    }
+    else if ((strlen("UPDATE") <= stmtStringLength) && (_strnicmp("UPDATE", stmtString, strlen("UPDATE")) == 0))
+    {
+        return EzSqlite::StmtType::kUpdate;
+    }
+    else if ((strlen("VACUUM") <= stmtStringLength) && (_strnicmp("VACUUM", stmtString, strlen("VACUUM")) == 0))
+    {
+        return EzSqlite::StmtType::kVacuum;
+    }
+    else
+    {
+        return EzSqlite::StmtType::kUnknown;
+    }
+}
+
+template <typename GetStmtTypeFunc>
+static double MeasureNanosecondsPerStmt(
+    _In_ GetStmtTypeFunc&& getStmtType,
+    _In_ uint32_t iterationNumber,
+    _Inout_ uint64_t& checksum
+)
+{
+    const uint32_t kStmtStringNumber = static_cast<uint32_t>(_countof(kBenchmarkStmtStringList));
+
+    std::chrono::steady_clock::time_point beginTime = std::chrono::steady_clock::now();
+
+    for (uint32_t iteration = 0; iteration < iterationNumber; iteration++)
+    {
+        checksum += static_cast<uint64_t>(getStmtType(kBenchmarkStmtStringList[iteration % kStmtStringNumber]));
+    }
+
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - beginTime).count() / iterationNumber;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t iterationNumber = kDefaultIterationNumber;
+    uint64_t prefixChecksum = 0;
+    uint64_t currentChecksum = 0;
+    double prefixNanoseconds = 0;
+    double currentNanoseconds = 0;
+
+    if (argc > 1)
+    {
+        iterationNumber = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10));
+        if (iterationNumber == 0)
+        {
+            iterationNumber = kDefaultIterationNumber;
+        }
+    }
+
+    for (const auto& stmtString : kBenchmarkStmtStringList)
+    {
+        if (GetStmtTypeByPrefix(stmtString) != EzSqlite::SqliteManager::GetStmtType(stmtString))
+        {
+            printf("FAILED \"%s\": different StmtType\n", stmtString);
+            return 1;
+        }
+    }
+
+    prefixNanoseconds = MeasureNanosecondsPerStmt(GetStmtTypeByPrefix, iterationNumber, prefixChecksum);
+    currentNanoseconds = MeasureNanosecondsPerStmt(EzSqlite::SqliteManager::GetStmtType, iterationNumber, currentChecksum);
+
+    // checksum을 출력해서 반복문이 최적화로 제거되지 않도록 함
+    printf("prefix compare: %.1f ns/stmt (checksum %llu)\n", prefixNanoseconds, static_cast<unsigned long long>(prefixChecksum));
+    printf("GetStmtType:    %.1f ns/stmt (checksum %llu)\n", currentNanoseconds, static_cast<unsigned long long>(currentChecksum));
+
+    if (prefixChecksum != currentChecksum)
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "src/SqliteManager.h"
+
+#include <cstdio>
+
+/*
+    SqliteManager::GetStmtType 분류 결과 검사
+    모든 StmtType 값이 한 번 이상 나오는지와 공백, 주석, 따옴표, WITH 절, 잘못된 명령문 처리를 확인하고 하나라도 다르면 실패 (종료 코드 1)
+*/
+
+struct StmtTypeTestCase
+{
+    const char* stmtString;
+    EzSqlite::StmtType stmtType;
+};
+
+const StmtTypeTestCase kStmtTypeTestCaseList[] =
+{
+    // 명령문 종류별
+    { "ALTER TABLE A_TB ADD COLUMN C_Size INTEGER;", EzSqlite::StmtType::kAlterTable },
+    { "alter\ttable A_TB rename to B_TB;", EzSqlite::StmtType::kAlterTable },
+    { "ANALYZE;", EzSqlite::StmtType::kAnalyze },
+    { "ATTACH 'Shard.db' AS Shard;", EzSqlite::StmtType::kAttach },
+    { "BEGIN IMMEDIATE;", EzSqlite::StmtType::kBegin },
+    { "begin;", EzSqlite::StmtType::kBegin },
+    { "COMMIT;", EzSqlite::StmtType::kCommit },
+    { "END TRANSACTION;", EzSqlite::StmtType::kCommit },
+    { "end", EzSqlite::StmtType::kCommit },
+    { "CREATE INDEX A_IDX ON A_TB(C_TimeStamp);", EzSqlite::StmtType::kCreateIndex },
+    { "CREATE UNIQUE INDEX IF NOT EXISTS A_IDX ON A_TB(C_EUID);", EzSqlite::StmtType::kCreateIndex },
+    { "CREATE TABLE A_TB (C_EUID INTEGER);", EzSqlite::StmtType::kCreateTable },
+    { "create temp table A_TB (C_EUID INTEGER);", EzSqlite::StmtType::kCreateTable },
+    { "CREATE TEMPORARY TABLE A_TB (C_EUID INTEGER);", EzSqlite::StmtType::kCreateTable },
+    { "CREATE TRIGGER A_TR AFTER INSERT ON A_TB BEGIN SELECT 1; END;", EzSqlite::StmtType::kCreateTrigger },
+    { "CREATE TEMP TRIGGER A_TR AFTER DELETE ON A_TB BEGIN SELECT 1; END;", EzSqlite::StmtType::kCreateTrigger },
+    { "CREATE TEMPORARY TRIGGER A_TR AFTER DELETE ON A_TB BEGIN SELECT 1; END;", EzSqlite::StmtType::kCreateTrigger },
+    { "CREATE VIEW A_VW AS SELECT 1;", EzSqlite::StmtType::kCreateView },
+    { "CREATE TEMP VIEW A_VW AS SELECT 1;", EzSqlite::StmtType::kCreateView },
+    { "CREATE TEMPORARY VIEW A_VW AS SELECT 1;", EzSqlite::StmtType::kCreateView },
+    { "CREATE VIRTUAL TABLE A_FTS USING fts5(ED_Path);", EzSqlite::StmtType::kCreateVirtualTable },
+    { "DELETE FROM A_TB;", EzSqlite::StmtType::kDelete },
+    { "DETACH Shard;", EzSqlite::StmtType::kDetach },
+    { "DROP INDEX A_IDX;", EzSqlite::StmtType::kDropIndex },
+    { "DROP TABLE IF EXISTS A_TB;", EzSqlite::StmtType::kDropTable },
+    { "DROP TRIGGER A_TR;", EzSqlite::StmtType::kDropTrigger },
+    { "DROP VIEW A_VW;", EzSqlite::StmtType::kDropView },
+    { "INSERT INTO A_TB VALUES (1);", EzSqlite::StmtType::kInsert },
+    { "INSERT OR IGNORE INTO A_TB VALUES (1);", EzSqlite::StmtType::kInsert },
+    { "REPLACE INTO A_TB VALUES (1);", EzSqlite::StmtType::kInsert },
+    { "insert or replace into A_TB values (1);", EzSqlite::StmtType::kInsert },
+    { "PRAGMA user_version;", EzSqlite::StmtType::kPragma },
+    { "REINDEX;", EzSqlite::StmtType::kReindex },
+    { "RELEASE A_SP;", EzSqlite::StmtType::kRelease },
+    { "ROLLBACK TO A_SP;", EzSqlite::StmtType::kRollback },
+    { "SAVEPOINT A_SP;", EzSqlite::StmtType::kSavepoint },
+    { "SELECT 1;", EzSqlite::StmtType::kSelect },
+    { "select*from A_TB;", EzSqlite::StmtType::kSelect },
+    { "VALUES (1), (2);", EzSqlite::StmtType::kSelect },
+    { "UPDATE A_TB SET C_EUID = 1;", EzSqlite::StmtType::kUpdate },
+    { "UPDATE OR IGNORE A_TB SET C_EUID = 1;", EzSqlite::StmtType::kUpdate },
+    { "VACUUM;", EzSqlite::StmtType::kVacuum },
+
+    // 앞쪽 공백, 주석
+    { "  \n\t-- comment\n /* block\n comment */ SELECT 1;", EzSqlite::StmtType::kSelect },
+    { "/*x*/PRAGMA user_version;", EzSqlite::StmtType::kPragma },
+    { "-- comment only", EzSqlite::StmtType::kUnknown },
+    { "/* unterminated comment", EzSqlite::StmtType::kUnknown },
+
+    // WITH 절 (괄호, 따옴표 안의 키워드는 무시)
+    { "WITH C AS (SELECT 1) SELECT * FROM C;", EzSqlite::StmtType::kSelect },
+    { "WITH RECURSIVE C(N) AS (SELECT 1 UNION ALL SELECT N + 1 FROM C WHERE N < 9) SELECT N FROM C;", EzSqlite::StmtType::kSelect },
+    { "WITH C AS (SELECT 1), D AS MATERIALIZED (SELECT 2) INSERT INTO A_TB SELECT * FROM C;", EzSqlite::StmtType::kInsert },
+    { "WITH C AS NOT MATERIALIZED (SELECT 'x)' AS Y) UPDATE A_TB SET C_EUID = 1;", EzSqlite::StmtType::kUpdate },
+    { "WITH \"select\" AS (SELECT 1) DELETE FROM A_TB WHERE C_EUID IN \"select\";", EzSqlite::StmtType::kDelete },
+    { "WITH [insert] AS (VALUES (1)) REPLACE INTO A_TB SELECT * FROM [insert];", EzSqlite::StmtType::kInsert },
+    { "WITH `delete` AS (SELECT ')') SELECT * FROM `delete`;", EzSqlite::StmtType::kSelect },
+    { "WITH C AS (SELECT 1", EzSqlite::StmtType::kUnknown },
+    { "WITH )", EzSqlite::StmtType::kUnknown },
+
+    // 지원하지 않거나 잘못된 명령문
+    { "", EzSqlite::StmtType::kUnknown },
+    { "   ", EzSqlite::StmtType::kUnknown },
+    { "EXPLAIN SELECT 1;", EzSqlite::StmtType::kUnknown },
+    { "ALTER VIEW A_VW;", EzSqlite::StmtType::kUnknown },
+    { "CREATE VIRTUALTABLE A_FTS;", EzSqlite::StmtType::kUnknown },
+    { "CREATE TABLES;", EzSqlite::StmtType::kUnknown },
+    { "DROP;", EzSqlite::StmtType::kUnknown },
+    { "SELECTX;", EzSqlite::StmtType::kUnknown },
+    { "SELEC", EzSqlite::StmtType::kUnknown },
+    { "(SELECT 1);", EzSqlite::StmtType::kUnknown },
+    { "_select;", EzSqlite::StmtType::kUnknown },
+    { "'SELECT 1';", EzSqlite::StmtType::kUnknown },
+    { "\xEC\x95\x88", EzSqlite::StmtType::kUnknown },
+};
+
+int main(void)
+{
+    const uint32_t kStmtTypeNumber = static_cast<uint32_t>(EzSqlite::StmtType::kUnknown) + 1;
+
+    bool coveredStmtTypeList[kStmtTypeNumber] = {};
+    uint32_t failedCount = 0;
+
+    for (const auto& stmtTypeTestCase : kStmtTypeTestCaseList)
+    {
+        EzSqlite::StmtType stmtType = EzSqlite::SqliteManager::GetStmtType(stmtTypeTestCase.stmtString);
+        if (stmtType != stmtTypeTestCase.stmtType)
+        {
+            printf("FAILED \"%s\": %u (expected %u)\n", stmtTypeTestCase.stmtString, static_cast<uint32_t>(stmtType), static_cast<uint32_t>(stmtTypeTestCase.stmtType));
+            failedCount++;
+            continue;
+        }
+
+        coveredStmtTypeList[static_cast<uint32_t>(stmtType)] = true;
+    }
+
+    for (uint32_t stmtTypeIndex = 0; stmtTypeIndex < kStmtTypeNumber; stmtTypeIndex++)
+    {
+        if (coveredStmtTypeList[stmtTypeIndex] == false)
+        {
+            printf("FAILED StmtType %u has no test case\n", stmtTypeIndex);
+            failedCount++;
+        }
+    }
+
+    printf("%u cases, %u failed\n", static_cast<uint32_t>(_countof(kStmtTypeTestCaseList)), failedCount);
+    if (failedCount != 0)
+    {
+        return 1;
+    }
+
+    printf("OK\n");
+    return 0;
+}
\ No newline at end of file
@@ -62,7 +62,7 @@ int main(void)
     EzSqlite::SqliteManager sqliteManager;
     std::wstring databasePath = L"e.db";
 
-    uint32_t preparedStmt1Index = 0;
+    EzSqlite::StmtHandle preparedStmt1Handle;
     ULONGLONG bindParam1 = 131890523976951191;
     ULONGLONG bindParam2 = 131890523976986106;
 
@@ -83,6 +83,8 @@ int main(void)
         databasePath,
         EzSqlite::DesiredAccess::kReadWrite, 
         EzSqlite::CreationDisposition::kOpenExisting,
+        nullptr,
+        nullptr,
         kCheckTableStmtStringList
     );
 
@@ -96,12 +98,12 @@ int main(void)
     stmtBindParameterInfo.dataByteSize = sizeof(ULONGLONG);
     stmtBindParameterInfoList.push_back(stmtBindParameterInfo);
 
-    sqliteManager.PrepareStmt("SELECT * FROM PROCESSEVENT_TB WHERE C_TimeStamp > ? AND C_TimeStamp < ?;", &preparedStmt1Index);
-    sqliteManager.ExecStmt(preparedStmt1Index, &stmtBindParameterInfoList, &stepCallback);
+    sqliteManager.PrepareStmt("SELECT * FROM PROCESSEVENT_TB WHERE C_TimeStamp > ? AND C_TimeStamp < ?;", SQLITE_PREPARE_PERSISTENT, &preparedStmt1Handle);
+    sqliteManager.ExecStmt(preparedStmt1Handle, &stmtBindParameterInfoList, &stepCallback);
     //sqliteManager.ExecStmt("SELECT * FROM PROCESSEVENT_TB WHERE C_TimeStamp > ? AND C_TimeStamp < ?;", &stmtBindParameterInfoList, &stepCallback);
-    //sqliteManager.ExecStmt(preparedStmt1Index, &stmtBindParameterInfoList, &stepLambdaCallback);
+    //sqliteManager.ExecStmt(preparedStmt1Handle, &stmtBindParameterInfoList, &stepLambdaCallback);
 
-    sqliteManager.CloseDatabase(false, true);
+    sqliteManager.CloseDatabase(false);
 
     return 0;
 }
\ No newline at end of file
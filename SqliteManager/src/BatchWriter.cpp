@@ -0,0 +1,209 @@
+#include "BatchWriter.h"
+
+EzSqlite::BatchWriter::BatchWriter(
+    _In_ SqliteManager& sqliteManager,
+    _In_opt_ const BatchWriterOptions& batchWriterOptions /*= BatchWriterOptions()*/
+) : sqliteManager_(sqliteManager)
+{
+    batchWriterOptions_ = batchWriterOptions;
+    inBatch_ = false;
+}
+
+EzSqlite::BatchWriter::~BatchWriter()
+{
+    this->Flush();
+}
+
+EzSqlite::Errors EzSqlite::BatchWriter::Insert(
+    _In_ StmtHandle preparedStmtHandle,
+    _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ uint32_t stmtBindParameterInfoCount
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    uint32_t rowByteSize = 0;
+
+    for (uint32_t stmtBindParameterInfoIndex = 0; stmtBindParameterInfoIndex < stmtBindParameterInfoCount; stmtBindParameterInfoIndex++)
+    {
+        const StmtBindParameterInfo& stmtBindParameterInfo = stmtBindParameterInfoList[stmtBindParameterInfoIndex];
+
+        switch (stmtBindParameterInfo.dataType)
+        {
+        case StmtDataType::kText:
+            if (stmtBindParameterInfo.dataByteSize == static_cast<uint32_t>(-1))
+            {
+                rowByteSize += GetParameterByteSize_(static_cast<const std::string::traits_type::char_type*>(stmtBindParameterInfo.data));
+            }
+            else
+            {
+                rowByteSize += stmtBindParameterInfo.dataByteSize;
+            }
+            break;
+
+        case StmtDataType::kBlob:
+            rowByteSize += stmtBindParameterInfo.dataByteSize;
+            break;
+
+        case StmtDataType::kNull:
+            break;
+
+        default:
+            rowByteSize += sizeof(int64_t);
+            break;
+        }
+    }
+
+    retValue = BeginBatch_();
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = EndBatch_(sqliteManager_.ExecStmt(preparedStmtHandle, stmtBindParameterInfoList, stmtBindParameterInfoCount), rowByteSize);
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::BatchWriter::Flush()
+{
+    return Commit_(FlushReason::kExplicit);
+}
+
+EzSqlite::Errors EzSqlite::BatchWriter::FlushIfExpired()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    if ((inBatch_ == true) &&
+        (batchWriterOptions_.maxLatencyMilliseconds != 0) &&
+        (std::chrono::steady_clock::now() - batchBeginTime_ >= std::chrono::milliseconds(batchWriterOptions_.maxLatencyMilliseconds)))
+    {
+        return Commit_(FlushReason::kDeadline);
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::BatchWriter::SetOptions(
+    _In_ const BatchWriterOptions& batchWriterOptions
+)
+{
+    batchWriterOptions_ = batchWriterOptions;
+}
+
+void EzSqlite::BatchWriter::GetStatistics(
+    _Out_ BatchWriterStatistics& batchWriterStatistics
+)
+{
+    batchWriterStatistics = batchWriterStatistics_;
+}
+
+EzSqlite::Errors EzSqlite::BatchWriter::BeginBatch_()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    if (inBatch_ == true)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    // 쓰기 잠금을 미리 잡아서 Commit 시점에 SQLITE_BUSY로 실패하지 않도록 BEGIN IMMEDIATE 사용
+    retValue = sqliteManager_.BeginTransaction(true);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    inBatch_ = true;
+    batchBeginTime_ = std::chrono::steady_clock::now();
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::BatchWriter::EndBatch_(
+    _In_ Errors execStatus,
+    _In_ uint32_t rowByteSize
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    // 실패한 행은 해당 명령문만 취소되고 트랜잭션은 유지됨
+    if (execStatus != Errors::kSuccess)
+    {
+        batchWriterStatistics_.failedRowCount++;
+
+        // 제약 조건 위반 등으로 SQLite가 트랜잭션 자체를 ROLLBACK한 경우 남은 행은 모두 취소된 것
+        if (sqliteManager_.IsInTransaction() == false)
+        {
+            batchWriterStatistics_.discardedRowCount += batchWriterStatistics_.pendingRowCount;
+            batchWriterStatistics_.pendingRowCount = 0;
+            batchWriterStatistics_.pendingByteSize = 0;
+            inBatch_ = false;
+        }
+
+        retValue = execStatus;
+        return retValue;
+    }
+
+    batchWriterStatistics_.pendingRowCount++;
+    batchWriterStatistics_.pendingByteSize += rowByteSize;
+
+    if ((batchWriterOptions_.maxRowCount != 0) && (batchWriterStatistics_.pendingRowCount >= batchWriterOptions_.maxRowCount))
+    {
+        return Commit_(FlushReason::kRowCount);
+    }
+
+    if ((batchWriterOptions_.maxByteSize != 0) && (batchWriterStatistics_.pendingByteSize >= batchWriterOptions_.maxByteSize))
+    {
+        return Commit_(FlushReason::kByteSize);
+    }
+
+    return FlushIfExpired();
+}
+
+EzSqlite::Errors EzSqlite::BatchWriter::Commit_(
+    _In_ FlushReason flushReason
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::chrono::steady_clock::time_point commitBeginTime;
+    uint64_t commitMicroseconds = 0;
+
+    if (inBatch_ == false)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    inBatch_ = false;
+
+    commitBeginTime = std::chrono::steady_clock::now();
+    retValue = sqliteManager_.CommitTransaction();
+    if (retValue != Errors::kSuccess)
+    {
+        sqliteManager_.RollbackTransaction();
+
+        batchWriterStatistics_.failedFlushCount++;
+        batchWriterStatistics_.discardedRowCount += batchWriterStatistics_.pendingRowCount;
+        batchWriterStatistics_.pendingRowCount = 0;
+        batchWriterStatistics_.pendingByteSize = 0;
+        return retValue;
+    }
+
+    commitMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - commitBeginTime).count());
+
+    batchWriterStatistics_.flushCountList[static_cast<uint32_t>(flushReason)]++;
+    batchWriterStatistics_.committedRowCount += batchWriterStatistics_.pendingRowCount;
+    batchWriterStatistics_.committedByteSize += batchWriterStatistics_.pendingByteSize;
+    batchWriterStatistics_.pendingRowCount = 0;
+    batchWriterStatistics_.pendingByteSize = 0;
+    batchWriterStatistics_.totalCommitMicroseconds += commitMicroseconds;
+    batchWriterStatistics_.maxCommitMicroseconds = (std::max)(batchWriterStatistics_.maxCommitMicroseconds, commitMicroseconds);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
\ No newline at end of file
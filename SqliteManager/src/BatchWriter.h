@@ -0,0 +1,170 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+#include <chrono>
+
+namespace EzSqlite
+{
+
+const uint32_t kDefaultBatchMaxRowCount = 4096;
+const uint32_t kDefaultBatchMaxByteSize = 4 * 1024 * 1024;
+const uint32_t kDefaultBatchMaxLatencyMilliseconds = 100;
+
+// 조건 중 하나라도 만족하면 Commit (0이면 해당 조건 사용 안 함)
+struct BatchWriterOptions
+{
+    BatchWriterOptions()
+    {
+        maxRowCount = kDefaultBatchMaxRowCount;
+        maxByteSize = kDefaultBatchMaxByteSize;
+        maxLatencyMilliseconds = kDefaultBatchMaxLatencyMilliseconds;
+    };
+
+    uint32_t maxRowCount;
+    uint32_t maxByteSize;               // Bind된 값 크기 합계 (정수, 실수는 8바이트로 계산)
+    uint32_t maxLatencyMilliseconds;    // 트랜잭션의 첫 행이 들어온 시점부터 Commit까지 최대 지연 시간
+};
+
+enum class FlushReason
+{
+    kRowCount,
+    kByteSize,
+    kDeadline,
+    kExplicit,      // Flush, 소멸자
+
+    kFlushReasonNumber
+};
+
+struct BatchWriterStatistics
+{
+    BatchWriterStatistics()
+    {
+        for (auto& flushCountListEntry : flushCountList)
+        {
+            flushCountListEntry = 0;
+        }
+        failedFlushCount = 0;
+        committedRowCount = 0;
+        committedByteSize = 0;
+        failedRowCount = 0;
+        discardedRowCount = 0;
+        pendingRowCount = 0;
+        pendingByteSize = 0;
+        totalCommitMicroseconds = 0;
+        maxCommitMicroseconds = 0;
+    };
+
+    uint64_t flushCountList[static_cast<uint32_t>(FlushReason::kFlushReasonNumber)];    // 성공한 Commit 횟수 (FlushReason별)
+    uint64_t failedFlushCount;      // COMMIT 실패로 ROLLBACK된 횟수
+    uint64_t committedRowCount;
+    uint64_t committedByteSize;
+    uint64_t failedRowCount;        // 실행 실패한 행 (트랜잭션에 포함되지 않음)
+    uint64_t discardedRowCount;     // COMMIT 실패로 ROLLBACK된 행
+    uint32_t pendingRowCount;       // 아직 Commit되지 않은 행
+    uint32_t pendingByteSize;
+    uint64_t totalCommitMicroseconds;
+    uint64_t maxCommitMicroseconds;
+};
+
+/*
+    INSERT 등 쓰기 명령문을 하나의 BEGIN IMMEDIATE 트랜잭션에 모아서 실행하고 한 번에 Commit (Group Commit)
+    명령문마다 fsync가 발생하지 않으므로 행 단위 실행보다 처리량이 훨씬 높음
+
+    행은 Insert 호출 시점에 바로 실행되고 Commit만 지연됨
+    maxLatencyMilliseconds는 Insert 호출 시점에 검사하므로, 입력이 끊기는 구간에서는 호출자가 주기적으로 FlushIfExpired를 호출해야 됨
+    BatchWriter가 트랜잭션을 열고 있는 동안에는 같은 SqliteManager에서 BEGIN, COMMIT을 직접 실행하면 안 됨
+    소멸 시 남은 행은 Commit
+*/
+class BatchWriter
+{
+public:
+    explicit BatchWriter(_In_ SqliteManager& sqliteManager, _In_opt_ const BatchWriterOptions& batchWriterOptions = BatchWriterOptions());
+    ~BatchWriter();
+
+    BatchWriter(const BatchWriter&) = delete;
+    BatchWriter& operator=(const BatchWriter&) = delete;
+
+    // 파라미터 Bind 규칙은 SqliteManager::ExecStmtWithParameters와 동일
+    template <typename... Params>
+    Errors InsertWithParameters(_In_ StmtHandle preparedStmtHandle, _In_ const Params&... params);
+    Errors Insert(
+        _In_ StmtHandle preparedStmtHandle,
+        _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+        _In_ uint32_t stmtBindParameterInfoCount
+    );
+
+    Errors Flush();
+    Errors FlushIfExpired();
+
+    // 다음 트랜잭션부터 적용
+    void SetOptions(_In_ const BatchWriterOptions& batchWriterOptions);
+    void GetStatistics(_Out_ BatchWriterStatistics& batchWriterStatistics);
+
+private:
+    Errors BeginBatch_();
+    Errors EndBatch_(_In_ Errors execStatus, _In_ uint32_t rowByteSize);
+    Errors Commit_(_In_ FlushReason flushReason);
+
+    template <typename Number>
+    static typename std::enable_if<std::is_arithmetic<Number>::value, uint32_t>::type GetParameterByteSize_(_In_ const Number&)
+    {
+        return sizeof(int64_t);
+    }
+    static uint32_t GetParameterByteSize_(_In_ const std::string::traits_type::char_type* parameter)
+    {
+        return (parameter == nullptr) ? 0 : static_cast<uint32_t>(std::string::traits_type::length(parameter));
+    }
+    static uint32_t GetParameterByteSize_(_In_ const std::string& parameter)
+    {
+        return static_cast<uint32_t>(parameter.size());
+    }
+    static uint32_t GetParameterByteSize_(_In_ const StmtText& parameter)
+    {
+        return (parameter.byteSize == 0) ? GetParameterByteSize_(parameter.data) : parameter.byteSize;
+    }
+    static uint32_t GetParameterByteSize_(_In_ const StmtBlob& parameter)
+    {
+        return parameter.byteSize;
+    }
+    static uint32_t GetParameterByteSize_(_In_ std::nullptr_t)
+    {
+        return 0;
+    }
+
+private:
+    SqliteManager& sqliteManager_;
+    BatchWriterOptions batchWriterOptions_;
+    BatchWriterStatistics batchWriterStatistics_;
+
+    bool inBatch_;
+    std::chrono::steady_clock::time_point batchBeginTime_;
+};
+
+template <typename... Params>
+Errors BatchWriter::InsertWithParameters(
+    _In_ StmtHandle preparedStmtHandle,
+    _In_ const Params&... params
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    uint32_t rowByteSize = 0;
+    const uint32_t parameterByteSizeList[] = { 0, GetParameterByteSize_(params)... };
+
+    retValue = BeginBatch_();
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (const auto& parameterByteSizeListEntry : parameterByteSizeList)
+    {
+        rowByteSize += parameterByteSizeListEntry;
+    }
+
+    retValue = EndBatch_(sqliteManager_.ExecStmtWithParameters(preparedStmtHandle, nullptr, params...), rowByteSize);
+    return retValue;
+}
+
+} // namespace EzSqlite
\ No newline at end of file
@@ -0,0 +1,370 @@
+#include "ChangeFeed.h"
+
+EzSqlite::ChangeFeed::ChangeFeed(
+    _In_opt_ const ChangeFeedOptions& changeFeedOptions /*= ChangeFeedOptions()*/
+) : changeFeedOptions_(changeFeedOptions)
+{
+    uint64_t capacity = 2;
+
+    while (capacity < changeFeedOptions_.capacity)
+    {
+        capacity <<= 1;
+    }
+    changeFeedOptions_.capacity = static_cast<uint32_t>(capacity);
+
+    if (changeFeedOptions_.maxDeliverEventCount == 0)
+    {
+        changeFeedOptions_.maxDeliverEventCount = 1;
+    }
+
+    slotList_.reset(new Slot[static_cast<size_t>(capacity)]);
+    for (uint64_t slotIndex = 0; slotIndex < capacity; slotIndex++)
+    {
+        slotList_[static_cast<size_t>(slotIndex)].sequence.store(0, std::memory_order_relaxed);
+    }
+    slotIndexMask_ = capacity - 1;
+
+    sqliteManager_ = nullptr;
+    writePosition_ = 0;
+    transactionSequence_ = 0;
+    publishedTransactionCount_ = 0;
+    nextSubscriberId_ = 1;
+    waitingSubscriberCount_ = 0;
+}
+
+EzSqlite::ChangeFeed::~ChangeFeed()
+{
+    this->Detach();
+
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    for (auto& subscriber : subscriberList_)
+    {
+        StopSubscriber_(subscriber.get());
+    }
+    subscriberList_.clear();
+}
+
+EzSqlite::Errors EzSqlite::ChangeFeed::Attach(
+    _In_ SqliteManager& sqliteManager
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    // 생산자가 하나라는 전제로 슬롯을 기록하므로 연결 하나만 허용
+    if (sqliteManager_ != nullptr)
+    {
+        return retValue;
+    }
+
+    sqliteManager_ = &sqliteManager;
+    sqliteManager_->SetBatchDataChangeNotificationCallback(BatchDataChangeNotificationCallback_, this);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::ChangeFeed::Detach()
+{
+    if (sqliteManager_ == nullptr)
+    {
+        return;
+    }
+
+    sqliteManager_->SetBatchDataChangeNotificationCallback(nullptr, nullptr);
+    sqliteManager_ = nullptr;
+}
+
+EzSqlite::Errors EzSqlite::ChangeFeed::Subscribe(
+    _In_ const ChangeFeedCallbackFunc& changeFeedCallback,
+    _Out_ uint32_t& subscriberId
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::unique_ptr<Subscriber> subscriber(new Subscriber());
+
+    if (!changeFeedCallback)
+    {
+        return retValue;
+    }
+
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+
+    subscriber->subscriberId = nextSubscriberId_++;
+    subscriber->changeFeedCallback = changeFeedCallback;
+    subscriber->stopRequested = false;
+    subscriber->readPosition = writePosition_.load(std::memory_order_acquire);
+    subscriber->deliveredEventCount = 0;
+    subscriber->overflowEventCount = 0;
+    subscriber->overflowCount = 0;
+    subscriber->subscriberThread = std::thread(&ChangeFeed::SubscriberThread_, this, subscriber.get());
+
+    subscriberId = subscriber->subscriberId;
+    subscriberList_.push_back(std::move(subscriber));
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ChangeFeed::Unsubscribe(
+    _In_ uint32_t subscriberId
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::unique_ptr<Subscriber> subscriber;
+
+    {
+        std::lock_guard<std::mutex> lock(subscriberMutex_);
+
+        for (auto subscriberIterator = subscriberList_.begin(); subscriberIterator != subscriberList_.end(); ++subscriberIterator)
+        {
+            if ((*subscriberIterator)->subscriberId == subscriberId)
+            {
+                subscriber = std::move(*subscriberIterator);
+                subscriberList_.erase(subscriberIterator);
+                break;
+            }
+        }
+    }
+
+    if (subscriber == nullptr)
+    {
+        retValue = Errors::kNotFound;
+        return retValue;
+    }
+
+    // 구독 스레드 종료를 기다리는 동안 다른 구독자 관리가 막히지 않도록 mutex 밖에서 정리
+    StopSubscriber_(subscriber.get());
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::ChangeFeed::GetStatistics(
+    _Out_ ChangeFeedStatistics& changeFeedStatistics
+)
+{
+    changeFeedStatistics.publishedEventCount = writePosition_.load(std::memory_order_relaxed);
+    changeFeedStatistics.publishedTransactionCount = publishedTransactionCount_.load(std::memory_order_relaxed);
+    changeFeedStatistics.capacity = changeFeedOptions_.capacity;
+
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    changeFeedStatistics.subscriberCount = static_cast<uint32_t>(subscriberList_.size());
+}
+
+EzSqlite::Errors EzSqlite::ChangeFeed::GetSubscriberStatistics(
+    _In_ uint32_t subscriberId,
+    _Out_ ChangeFeedSubscriberStatistics& changeFeedSubscriberStatistics
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    uint64_t writePosition = writePosition_.load(std::memory_order_relaxed);
+    uint64_t readPosition = 0;
+
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+
+    for (const auto& subscriber : subscriberList_)
+    {
+        if (subscriber->subscriberId != subscriberId)
+        {
+            continue;
+        }
+
+        readPosition = subscriber->readPosition.load(std::memory_order_relaxed);
+
+        changeFeedSubscriberStatistics.deliveredEventCount = subscriber->deliveredEventCount;
+        changeFeedSubscriberStatistics.overflowEventCount = subscriber->overflowEventCount;
+        changeFeedSubscriberStatistics.overflowCount = subscriber->overflowCount;
+        changeFeedSubscriberStatistics.lagEventCount = (writePosition > readPosition) ? writePosition - readPosition : 0;
+
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    retValue = Errors::kNotFound;
+    return retValue;
+}
+
+void EzSqlite::ChangeFeed::BatchDataChangeNotificationCallback_(
+    void* userContext,
+    const DataChangeRange* dataChangeRangeList,
+    uint32_t dataChangeRangeCount
+)
+{
+    static_cast<ChangeFeed*>(userContext)->Publish_(dataChangeRangeList, dataChangeRangeCount);
+}
+
+void EzSqlite::ChangeFeed::Publish_(
+    _In_reads_(dataChangeRangeCount) const DataChangeRange* dataChangeRangeList,
+    _In_ uint32_t dataChangeRangeCount
+)
+{
+    uint64_t position = writePosition_.load(std::memory_order_relaxed);
+
+    if (dataChangeRangeCount == 0)
+    {
+        return;
+    }
+
+    transactionSequence_++;
+
+    for (uint32_t dataChangeRangeIndex = 0; dataChangeRangeIndex < dataChangeRangeCount; dataChangeRangeIndex++, position++)
+    {
+        const DataChangeRange& dataChangeRange = dataChangeRangeList[dataChangeRangeIndex];
+        Slot& slot = slotList_[static_cast<size_t>(position & slotIndexMask_)];
+
+        // 이름 문자열은 sequence를 완료로 기록하기 전에 준비되어야 됨
+        const char* dbName = InternName_(dataChangeRange.dbName);
+        const char* tableName = InternName_(dataChangeRange.tableName);
+
+        slot.sequence.store(position * 2 + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot.transactionSequence.store(transactionSequence_, std::memory_order_relaxed);
+        slot.actionCode.store(static_cast<int>(dataChangeRange.actionCode), std::memory_order_relaxed);
+        slot.dbName.store(dbName, std::memory_order_relaxed);
+        slot.tableName.store(tableName, std::memory_order_relaxed);
+        slot.firstRowid.store(dataChangeRange.firstRowid, std::memory_order_relaxed);
+        slot.lastRowid.store(dataChangeRange.lastRowid, std::memory_order_relaxed);
+
+        slot.sequence.store(position * 2 + 2, std::memory_order_release);
+    }
+
+    publishedTransactionCount_.store(transactionSequence_, std::memory_order_relaxed);
+    writePosition_.store(position, std::memory_order_release);
+
+    if (waitingSubscriberCount_.load() != 0)
+    {
+        std::lock_guard<std::mutex> lock(waitMutex_);
+        waitConditionVariable_.notify_all();
+    }
+}
+
+const char* EzSqlite::ChangeFeed::InternName_(
+    _In_ const char* name
+)
+{
+    // 테이블 수가 적으므로 최근에 추가된 이름부터 선형 검색
+    for (auto nameIterator = nameList_.rbegin(); nameIterator != nameList_.rend(); ++nameIterator)
+    {
+        if (*nameIterator == name)
+        {
+            return nameIterator->c_str();
+        }
+    }
+
+    nameList_.emplace_back(name);
+    return nameList_.back().c_str();
+}
+
+EzSqlite::ChangeFeed::ReadStatus EzSqlite::ChangeFeed::ReadEvent_(
+    _In_ uint64_t position,
+    _Out_ ChangeFeedEvent& changeFeedEvent
+)
+{
+    const Slot& slot = slotList_[static_cast<size_t>(position & slotIndexMask_)];
+    uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+    // 이전 바퀴의 이벤트이거나 쓰는 중
+    if (sequence < position * 2 + 2)
+    {
+        return ReadStatus::kEmpty;
+    }
+
+    if (sequence > position * 2 + 2)
+    {
+        return ReadStatus::kOverwritten;
+    }
+
+    changeFeedEvent.transactionSequence = slot.transactionSequence.load(std::memory_order_relaxed);
+    changeFeedEvent.actionCode = static_cast<CallbackActionCode>(slot.actionCode.load(std::memory_order_relaxed));
+    changeFeedEvent.dbName = slot.dbName.load(std::memory_order_relaxed);
+    changeFeedEvent.tableName = slot.tableName.load(std::memory_order_relaxed);
+    changeFeedEvent.firstRowid = slot.firstRowid.load(std::memory_order_relaxed);
+    changeFeedEvent.lastRowid = slot.lastRowid.load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+    {
+        return ReadStatus::kOverwritten;
+    }
+
+    return ReadStatus::kRead;
+}
+
+void EzSqlite::ChangeFeed::SubscriberThread_(
+    _In_ Subscriber* subscriber
+)
+{
+    std::vector<ChangeFeedEvent> changeFeedEventList(changeFeedOptions_.maxDeliverEventCount);
+    uint32_t changeFeedEventCount = 0;
+    uint64_t readPosition = subscriber->readPosition.load(std::memory_order_relaxed);
+    uint64_t writePosition = 0;
+    uint64_t oldestPosition = 0;
+
+    while (subscriber->stopRequested.load(std::memory_order_relaxed) == false)
+    {
+        for (changeFeedEventCount = 0; changeFeedEventCount < changeFeedOptions_.maxDeliverEventCount; )
+        {
+            ReadStatus readStatus = ReadEvent_(readPosition, changeFeedEventList[changeFeedEventCount]);
+
+            if (readStatus == ReadStatus::kRead)
+            {
+                readPosition++;
+                changeFeedEventCount++;
+                continue;
+            }
+
+            if (readStatus == ReadStatus::kEmpty)
+            {
+                break;
+            }
+
+            // 뒤처진 경우 ring buffer에 남아있는 가장 오래된 이벤트로 이동 (바로 다음 위치는 곧 덮어써질 수 있으므로 하나 더 건너뜀)
+            writePosition = writePosition_.load(std::memory_order_acquire);
+            oldestPosition = (writePosition > slotIndexMask_) ? writePosition - slotIndexMask_ : 0;
+            if (oldestPosition > readPosition)
+            {
+                subscriber->overflowEventCount.fetch_add(oldestPosition - readPosition, std::memory_order_relaxed);
+                subscriber->overflowCount.fetch_add(1, std::memory_order_relaxed);
+                readPosition = oldestPosition;
+            }
+        }
+
+        if (changeFeedEventCount != 0)
+        {
+            subscriber->changeFeedCallback(changeFeedEventList.data(), changeFeedEventCount);
+            subscriber->deliveredEventCount.fetch_add(changeFeedEventCount, std::memory_order_relaxed);
+            subscriber->readPosition.store(readPosition, std::memory_order_relaxed);
+            continue;
+        }
+
+        subscriber->readPosition.store(readPosition, std::memory_order_relaxed);
+
+        std::unique_lock<std::mutex> lock(waitMutex_);
+        waitingSubscriberCount_++;
+        if ((writePosition_.load() == readPosition) && (subscriber->stopRequested == false))
+        {
+            waitConditionVariable_.wait_for(lock, std::chrono::milliseconds(changeFeedOptions_.idleWaitMilliseconds));
+        }
+        waitingSubscriberCount_--;
+    }
+}
+
+void EzSqlite::ChangeFeed::StopSubscriber_(
+    _In_ Subscriber* subscriber
+)
+{
+    subscriber->stopRequested = true;
+    {
+        std::lock_guard<std::mutex> lock(waitMutex_);
+        waitConditionVariable_.notify_all();
+    }
+
+    if (subscriber->subscriberThread.joinable() == true)
+    {
+        subscriber->subscriberThread.join();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+#include <atomic>
+#include <thread>
+#include <memory>
+
+namespace EzSqlite
+{
+
+const uint32_t kDefaultChangeFeedCapacity = 16 * 1024;
+const uint32_t kDefaultChangeFeedIdleWaitMilliseconds = 10;
+const uint32_t kDefaultChangeFeedMaxDeliverEventCount = 256;
+
+struct ChangeFeedOptions
+{
+    ChangeFeedOptions()
+    {
+        capacity = kDefaultChangeFeedCapacity;
+        idleWaitMilliseconds = kDefaultChangeFeedIdleWaitMilliseconds;
+        maxDeliverEventCount = kDefaultChangeFeedMaxDeliverEventCount;
+    };
+
+    uint32_t capacity;                  // 2의 거듭제곱으로 올림
+    uint32_t idleWaitMilliseconds;      // 새 이벤트가 없을 때 구독 스레드가 대기하는 최대 시간
+    uint32_t maxDeliverEventCount;      // 콜백 한 번에 전달하는 최대 이벤트 수
+};
+
+// DataChangeRange 하나에 해당
+struct ChangeFeedEvent
+{
+    ChangeFeedEvent()
+    {
+        transactionSequence = 0;
+        actionCode = CallbackActionCode::kInsert;
+        dbName = nullptr;
+        tableName = nullptr;
+        firstRowid = 0;
+        lastRowid = 0;
+    };
+
+    uint64_t transactionSequence;   // COMMIT마다 1씩 증가 (같은 트랜잭션의 이벤트는 같은 값)
+    CallbackActionCode actionCode;
+    char const* dbName;             // ChangeFeed가 소멸되기 전까지 유효
+    char const* tableName;
+    sqlite_int64 firstRowid;
+    sqlite_int64 lastRowid;
+};
+
+struct ChangeFeedStatistics
+{
+    ChangeFeedStatistics()
+    {
+        publishedEventCount = 0;
+        publishedTransactionCount = 0;
+        subscriberCount = 0;
+        capacity = 0;
+    };
+
+    uint64_t publishedEventCount;
+    uint64_t publishedTransactionCount;
+    uint32_t subscriberCount;
+    uint32_t capacity;
+};
+
+struct ChangeFeedSubscriberStatistics
+{
+    ChangeFeedSubscriberStatistics()
+    {
+        deliveredEventCount = 0;
+        overflowEventCount = 0;
+        overflowCount = 0;
+        lagEventCount = 0;
+    };
+
+    uint64_t deliveredEventCount;
+    uint64_t overflowEventCount;    // 읽기 전에 덮어써져서 건너뛴 이벤트
+    uint64_t overflowCount;         // 건너뛴 횟수
+    uint64_t lagEventCount;         // 아직 전달되지 않은 이벤트
+};
+
+typedef std::function<void(const ChangeFeedEvent* changeFeedEventList, uint32_t changeFeedEventCount)> ChangeFeedCallbackFunc;
+
+/*
+    SqliteManager의 트랜잭션 단위 변경 알림(SetBatchDataChangeNotificationCallback)을 고정 크기 ring buffer에 기록하고
+    구독자마다 전용 스레드에서 각자의 위치(cursor)로 읽어서 콜백 호출
+
+    생산자는 Attach한 SqliteManager 하나 (COMMIT한 스레드)이고, 구독자를 기다리지 않으므로 느린 콜백이 쓰기를 막지 않음
+    구독자가 한 바퀴 이상 뒤처지면 덮어써진 이벤트를 건너뛰고 overflowEventCount에 기록
+
+    슬롯은 seqlock 방식 (쓰는 중에는 sequence가 홀수, 완료되면 짝수)
+    구독자는 읽은 뒤 sequence가 바뀌지 않았는지 확인하고, 바뀌었으면 덮어써진 것으로 처리
+
+    콜백은 구독 스레드에서 호출되므로 SqliteManager를 사용하려면 별도 연결을 사용해야 됨
+*/
+class ChangeFeed
+{
+public:
+    explicit ChangeFeed(_In_opt_ const ChangeFeedOptions& changeFeedOptions = ChangeFeedOptions());
+    ~ChangeFeed();
+
+    ChangeFeed(const ChangeFeed&) = delete;
+    ChangeFeed& operator=(const ChangeFeed&) = delete;
+
+    // sqliteManager의 일괄 변경 알림 콜백을 교체 (이미 Attach된 경우 kUnsuccess)
+    // Detach 전까지 sqliteManager가 유지되어야 됨
+    Errors Attach(_In_ SqliteManager& sqliteManager);
+    void Detach();
+
+    // 구독 시점 이후에 기록된 이벤트부터 전달
+    // Unsubscribe는 구독 스레드 종료를 기다리므로 콜백 안에서 호출하면 안 됨
+    Errors Subscribe(_In_ const ChangeFeedCallbackFunc& changeFeedCallback, _Out_ uint32_t& subscriberId);
+    Errors Unsubscribe(_In_ uint32_t subscriberId);
+
+    void GetStatistics(_Out_ ChangeFeedStatistics& changeFeedStatistics);
+    Errors GetSubscriberStatistics(_In_ uint32_t subscriberId, _Out_ ChangeFeedSubscriberStatistics& changeFeedSubscriberStatistics);
+
+private:
+    struct Slot
+    {
+        // 구독자가 쓰는 중인 슬롯을 읽을 수 있으므로 내용도 atomic (relaxed)
+        std::atomic<uint64_t> sequence;     // 위치 position의 이벤트를 쓰는 중이면 position * 2 + 1, 완료되면 position * 2 + 2
+        std::atomic<uint64_t> transactionSequence;
+        std::atomic<int> actionCode;
+        std::atomic<const char*> dbName;
+        std::atomic<const char*> tableName;
+        std::atomic<sqlite_int64> firstRowid;
+        std::atomic<sqlite_int64> lastRowid;
+    };
+
+    enum class ReadStatus
+    {
+        kRead,
+        kEmpty,
+        kOverwritten
+    };
+
+    struct Subscriber
+    {
+        uint32_t subscriberId;
+        ChangeFeedCallbackFunc changeFeedCallback;
+        std::thread subscriberThread;
+        std::atomic<bool> stopRequested;
+        std::atomic<uint64_t> readPosition;
+        std::atomic<uint64_t> deliveredEventCount;
+        std::atomic<uint64_t> overflowEventCount;
+        std::atomic<uint64_t> overflowCount;
+    };
+
+    static void BatchDataChangeNotificationCallback_(void* userContext, const DataChangeRange* dataChangeRangeList, uint32_t dataChangeRangeCount);
+    void Publish_(_In_reads_(dataChangeRangeCount) const DataChangeRange* dataChangeRangeList, _In_ uint32_t dataChangeRangeCount);
+    const char* InternName_(_In_ const char* name);
+    ReadStatus ReadEvent_(_In_ uint64_t position, _Out_ ChangeFeedEvent& changeFeedEvent);
+    void SubscriberThread_(_In_ Subscriber* subscriber);
+    void StopSubscriber_(_In_ Subscriber* subscriber);
+
+private:
+    ChangeFeedOptions changeFeedOptions_;
+    SqliteManager* sqliteManager_;
+
+    std::unique_ptr<Slot[]> slotList_;
+    uint64_t slotIndexMask_;
+
+    // 생산자 위치를 구독자 통계 등 다른 멤버와 다른 캐시 라인에 배치 (false sharing 방지)
+    char writePositionPadding_[kCacheLineSize];
+    std::atomic<uint64_t> writePosition_;
+    char transactionSequencePadding_[kCacheLineSize - sizeof(std::atomic<uint64_t>)];
+
+    // 생산자 전용
+    uint64_t transactionSequence_;
+    std::deque<std::string> nameList_;  // 이벤트의 dbName, tableName이 가리키는 문자열 (주소가 바뀌지 않도록 deque 사용)
+    std::atomic<uint64_t> publishedTransactionCount_;
+
+    std::mutex subscriberMutex_;
+    std::list<std::unique_ptr<Subscriber>> subscriberList_;
+    uint32_t nextSubscriberId_;
+
+    // 대기 중인 구독자가 있을 때만 생산자가 mutex를 사용 (놓친 알림은 대기 시간 제한으로 복구)
+    std::mutex waitMutex_;
+    std::condition_variable waitConditionVariable_;
+    std::atomic<uint32_t> waitingSubscriberCount_;
+};
+
+} // namespace EzSqlite
\ No newline at end of file
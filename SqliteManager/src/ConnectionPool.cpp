@@ -0,0 +1,706 @@
+#include "ConnectionPool.h"
+
+EzSqlite::ConnectionLease::ConnectionLease(
+    _In_opt_ ConnectionPool* connectionPool,
+    _In_opt_ Connection* connection
+) : connectionPool_(connectionPool), connection_(connection)
+{
+
+}
+
+EzSqlite::ConnectionLease::ConnectionLease(
+    ConnectionLease&& other
+) : connectionPool_(other.connectionPool_), connection_(other.connection_)
+{
+    other.connectionPool_ = nullptr;
+    other.connection_ = nullptr;
+}
+
+EzSqlite::ConnectionLease::~ConnectionLease()
+{
+    this->Release();
+}
+
+EzSqlite::SqliteManager& EzSqlite::ConnectionLease::operator*() const
+{
+    return connection_->sqliteManager;
+}
+
+EzSqlite::SqliteManager* EzSqlite::ConnectionLease::operator->() const
+{
+    return &connection_->sqliteManager;
+}
+
+EzSqlite::Errors EzSqlite::ConnectionLease::GetStmtHandle(
+    _In_ PoolStmtHandle poolStmtHandle,
+    _Out_ StmtHandle& stmtHandle
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    if (connection_ == nullptr)
+    {
+        return retValue;
+    }
+
+    retValue = connectionPool_->GetStmtHandle_(*connection_, poolStmtHandle, stmtHandle);
+    return retValue;
+}
+
+void EzSqlite::ConnectionLease::Release()
+{
+    if (connection_ == nullptr)
+    {
+        return;
+    }
+
+    connectionPool_->ReleaseConnection_(connection_);
+    connectionPool_ = nullptr;
+    connection_ = nullptr;
+}
+
+EzSqlite::ConnectionPool::ConnectionPool()
+{
+    writerInUse_ = false;
+}
+
+EzSqlite::ConnectionPool::~ConnectionPool()
+{
+    this->Close();
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::Open(
+    _In_ const std::wstring& databasePath,
+    _In_ CreationDisposition creationDisposition,
+    _In_ uint32_t readerCount,
+    _In_opt_ FPDataChangeNotificationCallback dataChangeNotificationCallback,
+    _In_opt_ void* dataChangeNotificationCallbackUserContext,
+    _In_ const std::vector<std::string>& verifyTableStmtStringList,
+    _In_opt_ const std::vector<std::string>* createTableStmtStringList /*= nullptr*/,
+    _In_opt_ const OpenOptions* openOptions /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    if (writerConnection_ != nullptr)
+    {
+        return retValue;
+    }
+
+    retValue = OpenConnections_(
+        databasePath,
+        creationDisposition,
+        readerCount,
+        dataChangeNotificationCallback,
+        dataChangeNotificationCallbackUserContext,
+        verifyTableStmtStringList,
+        createTableStmtStringList,
+        openOptions
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        this->Close();
+    }
+
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::Close()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::lock_guard<std::mutex> lock(connectionMutex_);
+
+    // 빌려간 연결이 남아있으면 닫지 않음
+    if ((writerInUse_ == true) || (freeReaderConnectionList_.size() != readerConnectionList_.size()))
+    {
+        return retValue;
+    }
+
+    // 마지막 연결이 닫힐 때 WAL 파일이 Checkpoint 되도록 쓰기 연결을 마지막에 닫음
+    freeReaderConnectionList_.clear();
+    readerConnectionList_.clear();
+    writerConnection_.reset();
+
+    connectionPoolStatistics_.readerCount = 0;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::PrepareStmt(
+    _In_ const std::string& stmtString,
+    _In_opt_ uint32_t prepareFlags,
+    _Out_ PoolStmtHandle& poolStmtHandle
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    PoolStmtInfo poolStmtInfo;
+    const uint64_t stmtStringHash = SqliteManager::GetStmtStringHash(stmtString);
+
+    std::lock_guard<std::mutex> lock(poolStmtInfoListMutex_);
+
+    // 해시가 같은 항목만 문자열 비교
+    auto poolStmtIndexRange = poolStmtIndexMap_.equal_range(stmtStringHash);
+    for (auto poolStmtIndexIterator = poolStmtIndexRange.first; poolStmtIndexIterator != poolStmtIndexRange.second; ++poolStmtIndexIterator)
+    {
+        if (poolStmtInfoList_[poolStmtIndexIterator->second].stmtString == stmtString)
+        {
+            poolStmtHandle.index = poolStmtIndexIterator->second;
+
+            retValue = Errors::kSuccess;
+            return retValue;
+        }
+    }
+
+    poolStmtInfo.stmtString = stmtString;
+    poolStmtInfo.stmtStringHash = stmtStringHash;
+    poolStmtInfo.prepareFlags = prepareFlags;
+    poolStmtInfoList_.push_back(std::move(poolStmtInfo));
+
+    poolStmtHandle.index = static_cast<uint32_t>(poolStmtInfoList_.size() - 1);
+    poolStmtIndexMap_.emplace(stmtStringHash, poolStmtHandle.index);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::ConnectionLease EzSqlite::ConnectionPool::AcquireReader(
+    _In_opt_ uint32_t timeOutMilliseconds /*= 0*/
+)
+{
+    ConnectionLease::Connection* readerConnection = nullptr;
+    std::chrono::steady_clock::time_point waitBeginTime;
+
+    std::unique_lock<std::mutex> lock(connectionMutex_);
+
+    if (readerConnectionList_.empty() == true)
+    {
+        return ConnectionLease(nullptr, nullptr);
+    }
+
+    connectionPoolStatistics_.readerAcquireCount++;
+
+    if (freeReaderConnectionList_.empty() == true)
+    {
+        connectionPoolStatistics_.readerWaitCount++;
+        waitBeginTime = std::chrono::steady_clock::now();
+
+        auto predicate = [&]
+        {
+            return (freeReaderConnectionList_.empty() == false) || (readerConnectionList_.empty() == true);
+        };
+
+        if (timeOutMilliseconds == 0)
+        {
+            connectionConditionVariable_.wait(lock, predicate);
+        }
+        else if (connectionConditionVariable_.wait_for(lock, std::chrono::milliseconds(timeOutMilliseconds), predicate) == false)
+        {
+            connectionPoolStatistics_.readerTimeOutCount++;
+        }
+
+        connectionPoolStatistics_.totalReaderWaitMicroseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - waitBeginTime).count());
+
+        if (freeReaderConnectionList_.empty() == true)
+        {
+            return ConnectionLease(nullptr, nullptr);
+        }
+    }
+
+    readerConnection = freeReaderConnectionList_.back();
+    freeReaderConnectionList_.pop_back();
+
+    return ConnectionLease(this, readerConnection);
+}
+
+EzSqlite::ConnectionLease EzSqlite::ConnectionPool::AcquireWriter()
+{
+    std::unique_lock<std::mutex> lock(connectionMutex_);
+
+    if (writerConnection_ == nullptr)
+    {
+        return ConnectionLease(nullptr, nullptr);
+    }
+
+    connectionPoolStatistics_.writerAcquireCount++;
+
+    if (writerInUse_ == true)
+    {
+        connectionPoolStatistics_.writerWaitCount++;
+        connectionConditionVariable_.wait(lock, [&]
+            {
+                return writerInUse_ == false;
+            });
+    }
+
+    writerInUse_ = true;
+
+    return ConnectionLease(this, writerConnection_.get());
+}
+
+void EzSqlite::ConnectionPool::GetStatistics(
+    _Out_ ConnectionPoolStatistics& connectionPoolStatistics
+)
+{
+    std::lock_guard<std::mutex> lock(connectionMutex_);
+
+    connectionPoolStatistics = connectionPoolStatistics_;
+    connectionPoolStatistics.freeReaderCount = static_cast<uint32_t>(freeReaderConnectionList_.size());
+}
+
+void EzSqlite::ConnectionPool::ReleaseConnection_(
+    _In_ ConnectionLease::Connection* connection
+)
+{
+    {
+        std::lock_guard<std::mutex> lock(connectionMutex_);
+
+        if (connection == writerConnection_.get())
+        {
+            writerInUse_ = false;
+        }
+        else
+        {
+            freeReaderConnectionList_.push_back(connection);
+        }
+    }
+
+    // 읽기 대기와 쓰기 대기가 같은 condition variable을 사용하므로 모두 깨움
+    connectionConditionVariable_.notify_all();
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::GetStmtHandle_(
+    _In_ ConnectionLease::Connection& connection,
+    _In_ PoolStmtHandle poolStmtHandle,
+    _Out_ StmtHandle& stmtHandle
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const PoolStmtInfo* poolStmtInfo = nullptr;
+
+    // 이미 Prepare된 경우 lock 없이 리턴 (connection은 lease 소유자만 사용)
+    if ((poolStmtHandle.index < connection.stmtHandleList.size()) && (connection.stmtHandleList[poolStmtHandle.index].generation != 0))
+    {
+        stmtHandle = connection.stmtHandleList[poolStmtHandle.index];
+
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(poolStmtInfoListMutex_);
+
+        if (poolStmtHandle.index >= poolStmtInfoList_.size())
+        {
+            retValue = Errors::kNotFound;
+            return retValue;
+        }
+
+        poolStmtInfo = &poolStmtInfoList_[poolStmtHandle.index];
+    }
+
+    if (poolStmtHandle.index >= connection.stmtHandleList.size())
+    {
+        connection.stmtHandleList.resize(poolStmtHandle.index + 1);
+    }
+
+    retValue = connection.sqliteManager.PrepareStmt(poolStmtInfo->stmtString, poolStmtInfo->prepareFlags, &connection.stmtHandleList[poolStmtHandle.index]);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(connectionMutex_);
+        connectionPoolStatistics_.mirroredPrepareCount++;
+    }
+
+    stmtHandle = connection.stmtHandleList[poolStmtHandle.index];
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::OpenConnections_(
+    _In_ const std::wstring& databasePath,
+    _In_ CreationDisposition creationDisposition,
+    _In_ uint32_t readerCount,
+    _In_opt_ FPDataChangeNotificationCallback dataChangeNotificationCallback,
+    _In_opt_ void* dataChangeNotificationCallbackUserContext,
+    _In_ const std::vector<std::string>& verifyTableStmtStringList,
+    _In_opt_ const std::vector<std::string>* createTableStmtStringList,
+    _In_opt_ const OpenOptions* openOptions
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::string journalMode;
+
+    writerConnection_.reset(new ConnectionLease::Connection());
+    retValue = writerConnection_->sqliteManager.CreateDatabase(
+        databasePath,
+        DesiredAccess::kReadWrite,
+        creationDisposition,
+        dataChangeNotificationCallback,
+        dataChangeNotificationCallbackUserContext,
+        verifyTableStmtStringList,
+        createTableStmtStringList,
+        openOptions
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        retValue = Errors::kUnsuccess;
+        return retValue;
+    }
+
+    // WAL 모드는 Database 파일에 기록되므로 이후 읽기 연결도 WAL 모드로 열림
+    StepCallbackFunc journalModeCallback = [&](const StmtInfo& stmtInfo)
+    {
+        journalMode = reinterpret_cast<const char*>(sqlite3_column_text(stmtInfo.stmt, 0));
+        return CallbackErrors::kContinue;
+    };
+    retValue = writerConnection_->sqliteManager.ExecStmt("PRAGMA journal_mode=WAL;", nullptr, &journalModeCallback);
+    if ((retValue != Errors::kSuccess) || (_strnicmp(journalMode.c_str(), "wal", 4) != 0))
+    {
+        retValue = Errors::kUnsuccess;
+        return retValue;
+    }
+
+    for (uint32_t readerIndex = 0; readerIndex < readerCount; readerIndex++)
+    {
+        std::unique_ptr<ConnectionLease::Connection> readerConnection(new ConnectionLease::Connection());
+
+        retValue = readerConnection->sqliteManager.CreateDatabase(
+            databasePath,
+            DesiredAccess::kReadOnly,
+            CreationDisposition::kOpenExisting,
+            nullptr,
+            nullptr,
+            verifyTableStmtStringList,
+            nullptr,
+            openOptions
+        );
+        if (retValue != Errors::kSuccess)
+        {
+            retValue = Errors::kUnsuccess;
+            return retValue;
+        }
+
+        freeReaderConnectionList_.push_back(readerConnection.get());
+        readerConnectionList_.push_back(std::move(readerConnection));
+    }
+
+    connectionPoolStatistics_.readerCount = readerCount;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::StartFanOutStreams_(
+    _In_ const std::vector<std::string>& stmtStringList,
+    _In_ const FanOutOptions& fanOutOptions,
+    _In_ const OpenCursorFunc& openCursor,
+    _Inout_ std::atomic<bool>& cancelled,
+    _Out_ std::vector<std::unique_ptr<FanOutStream>>& fanOutStreamList
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    bool boundedQueue = false;
+
+    if ((fanOutOptions.batchRowCount == 0) || (fanOutOptions.maxQueuedBatchNumber == 0))
+    {
+        return retValue;
+    }
+
+    for (size_t fanOutStreamIndex = 0; fanOutStreamIndex < stmtStringList.size(); fanOutStreamIndex++)
+    {
+        fanOutStreamList.push_back(std::unique_ptr<FanOutStream>(new FanOutStream()));
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(connectionMutex_);
+
+        if (readerConnectionList_.empty() == true)
+        {
+            return retValue;
+        }
+
+        // 모든 테이블이 동시에 읽기 연결을 가질 수 있을 때만 큐 크기를 제한 (아니면 연결을 기다리는 테이블 때문에 병합이 멈춤)
+        boundedQueue = readerConnectionList_.size() >= stmtStringList.size();
+        if (boundedQueue == true)
+        {
+            // 일부 연결만 잡고 대기하면 다른 ExecFanOutQuery와 서로의 연결을 기다릴 수 있으므로 한 번에 확보
+            connectionPoolStatistics_.readerAcquireCount += stmtStringList.size();
+            if (freeReaderConnectionList_.size() < stmtStringList.size())
+            {
+                connectionPoolStatistics_.readerWaitCount++;
+                connectionConditionVariable_.wait(lock, [&]
+                    {
+                        return (freeReaderConnectionList_.size() >= stmtStringList.size()) || (readerConnectionList_.empty() == true);
+                    });
+
+                if (readerConnectionList_.empty() == true)
+                {
+                    return retValue;
+                }
+            }
+
+            for (auto& fanOutStreamListEntry : fanOutStreamList)
+            {
+                fanOutStreamListEntry->connectionLease.reset(new ConnectionLease(this, freeReaderConnectionList_.back()));
+                freeReaderConnectionList_.pop_back();
+            }
+        }
+    }
+
+    for (size_t fanOutStreamIndex = 0; fanOutStreamIndex < stmtStringList.size(); fanOutStreamIndex++)
+    {
+        FanOutStream* fanOutStreamPointer = fanOutStreamList[fanOutStreamIndex].get();
+        const std::string* stmtStringPointer = &stmtStringList[fanOutStreamIndex];
+
+        fanOutStreamPointer->workerThread = std::thread([=, &fanOutOptions, &openCursor, &cancelled]
+            {
+                RunFanOutStream_(*fanOutStreamPointer, *stmtStringPointer, fanOutOptions, boundedQueue, openCursor, cancelled);
+            });
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::ConnectionPool::StopFanOutStreams_(
+    _Inout_ std::vector<std::unique_ptr<FanOutStream>>& fanOutStreamList,
+    _Inout_ std::atomic<bool>& cancelled
+)
+{
+    cancelled = true;
+
+    for (auto& fanOutStreamListEntry : fanOutStreamList)
+    {
+        {
+            std::lock_guard<std::mutex> lock(fanOutStreamListEntry->mutex);
+            fanOutStreamListEntry->conditionVariable.notify_all();
+        }
+
+        if (fanOutStreamListEntry->workerThread.joinable() == true)
+        {
+            fanOutStreamListEntry->workerThread.join();
+        }
+    }
+
+    fanOutStreamList.clear();
+}
+
+void EzSqlite::ConnectionPool::RunFanOutStream_(
+    _Inout_ FanOutStream& fanOutStream,
+    _In_ const std::string& stmtString,
+    _In_ const FanOutOptions& fanOutOptions,
+    _In_ bool boundedQueue,
+    _In_ const OpenCursorFunc& openCursor,
+    _In_ const std::atomic<bool>& cancelled
+)
+{
+    Errors streamStatus = Errors::kUnsuccess;
+
+    StmtHandle stmtHandle;
+    const StmtInfo* stmtInfo = nullptr;
+    std::vector<ColumnBuffer> columnBufferLayout;
+    std::unique_ptr<FanOutBatch> fanOutBatch;
+    uint32_t fetchedRowCount = 0;
+
+    auto raii = RAIIRegister([&]
+        {
+            std::lock_guard<std::mutex> lock(fanOutStream.mutex);
+
+            fanOutStream.finished = true;
+            fanOutStream.status = (streamStatus == Errors::kNoResult) ? Errors::kSuccess : streamStatus;
+            fanOutStream.conditionVariable.notify_all();
+        });
+
+    // cursor -> 명령문 Finalize -> lease 반납 순서로 소멸되도록 선언 순서 유지
+    ConnectionLease connectionLease = (fanOutStream.connectionLease != nullptr) ? std::move(*fanOutStream.connectionLease) : AcquireReader();
+    if (connectionLease.IsValid() == false)
+    {
+        return;
+    }
+
+    // 조회마다 달라지는 명령문이므로 이 연결에서만 Prepare하고 조회가 끝나면 Finalize
+    streamStatus = connectionLease->PrepareStmt(stmtString, 0, &stmtHandle);
+    if (streamStatus != Errors::kSuccess)
+    {
+        return;
+    }
+
+    auto stmtRaii = RAIIRegister([&]
+        {
+            connectionLease->FinalizePreparedStmt(stmtHandle);
+        });
+
+    streamStatus = connectionLease->FindPreparedStmt(stmtHandle, stmtInfo);
+    if (streamStatus != Errors::kSuccess)
+    {
+        return;
+    }
+
+    // 병합 스레드는 batchQueue에서 첫 batch를 꺼낸 후에 읽으므로 따로 잠그지 않음
+    streamStatus = FindFanOutOrderColumn_(stmtInfo->stmt, fanOutOptions.orderColumnName, fanOutStream.orderColumnIndex);
+    if (streamStatus != Errors::kSuccess)
+    {
+        return;
+    }
+    GetFanOutColumnLayout_(stmtInfo->stmt, fanOutStream.orderColumnIndex, columnBufferLayout);
+
+    ResultCursor resultCursor = openCursor(*connectionLease, stmtHandle);
+
+    while (cancelled == false)
+    {
+        {
+            std::lock_guard<std::mutex> lock(fanOutStream.mutex);
+
+            if (fanOutStream.freeBatchList.empty() == false)
+            {
+                fanOutBatch = std::move(fanOutStream.freeBatchList.back());
+                fanOutStream.freeBatchList.pop_back();
+            }
+        }
+
+        if (fanOutBatch == nullptr)
+        {
+            fanOutBatch.reset(new FanOutBatch());
+            fanOutBatch->columnBufferList = columnBufferLayout;
+        }
+
+        streamStatus = resultCursor.FetchColumnBatch(fanOutOptions.batchRowCount, fanOutBatch->columnBufferList, fetchedRowCount);
+        if (streamStatus != Errors::kSuccess)
+        {
+            break;
+        }
+        fanOutBatch->rowCount = fetchedRowCount;
+
+        std::unique_lock<std::mutex> lock(fanOutStream.mutex);
+        if (boundedQueue == true)
+        {
+            fanOutStream.conditionVariable.wait(lock, [&]
+                {
+                    return (fanOutStream.batchQueue.size() < fanOutOptions.maxQueuedBatchNumber) || (cancelled == true);
+                });
+        }
+        fanOutStream.batchQueue.push_back(std::move(fanOutBatch));
+        fanOutStream.conditionVariable.notify_all();
+    }
+}
+
+std::unique_ptr<EzSqlite::FanOutBatch> EzSqlite::ConnectionPool::PopFanOutBatch_(
+    _Inout_ FanOutStream& fanOutStream,
+    _Out_ Errors& streamStatus
+)
+{
+    std::unique_ptr<FanOutBatch> fanOutBatch;
+
+    std::unique_lock<std::mutex> lock(fanOutStream.mutex);
+    fanOutStream.conditionVariable.wait(lock, [&]
+        {
+            return (fanOutStream.batchQueue.empty() == false) || (fanOutStream.finished == true);
+        });
+
+    if (fanOutStream.batchQueue.empty() == false)
+    {
+        fanOutBatch = std::move(fanOutStream.batchQueue.front());
+        fanOutStream.batchQueue.pop_front();
+        fanOutStream.conditionVariable.notify_all();
+
+        streamStatus = Errors::kSuccess;
+    }
+    else
+    {
+        streamStatus = fanOutStream.status;
+    }
+
+    return fanOutBatch;
+}
+
+void EzSqlite::ConnectionPool::RecycleFanOutBatch_(
+    _Inout_ FanOutStream& fanOutStream,
+    _In_ std::unique_ptr<FanOutBatch> fanOutBatch
+)
+{
+    std::lock_guard<std::mutex> lock(fanOutStream.mutex);
+    fanOutStream.freeBatchList.push_back(std::move(fanOutBatch));
+}
+
+EzSqlite::Errors EzSqlite::ConnectionPool::FindFanOutOrderColumn_(
+    _In_ sqlite3_stmt* stmt,
+    _In_ const std::string& orderColumnName,
+    _Out_ uint32_t& orderColumnIndex
+)
+{
+    Errors retValue = Errors::kNotFound;
+
+    const int columnCount = sqlite3_column_count(stmt);
+
+    orderColumnIndex = 0;
+
+    // 컬럼 이름은 대소문자를 구분하지 않음 (AS로 지정한 이름이 있으면 그 이름과 비교)
+    for (int columnIndex = 0; columnIndex < columnCount; columnIndex++)
+    {
+        const char* columnName = sqlite3_column_name(stmt, columnIndex);
+        if ((columnName != nullptr) && (_stricmp(columnName, orderColumnName.c_str()) == 0))
+        {
+            orderColumnIndex = static_cast<uint32_t>(columnIndex);
+
+            retValue = Errors::kSuccess;
+            return retValue;
+        }
+    }
+
+    return retValue;
+}
+
+void EzSqlite::ConnectionPool::GetFanOutColumnLayout_(
+    _In_ sqlite3_stmt* stmt,
+    _In_ uint32_t orderColumnIndex,
+    _Out_ std::vector<ColumnBuffer>& columnBufferList
+)
+{
+    const int columnCount = sqlite3_column_count(stmt);
+
+    columnBufferList.clear();
+
+    for (int columnIndex = 0; columnIndex < columnCount; columnIndex++)
+    {
+        const char* declaredType = sqlite3_column_decltype(stmt, columnIndex);
+        std::string upperDeclaredType = (declaredType == nullptr) ? "" : declaredType;
+        StmtDataType dataType = StmtDataType::kText;
+
+        std::transform(upperDeclaredType.begin(), upperDeclaredType.end(), upperDeclaredType.begin(), ::toupper);
+
+        // SQLite 컬럼 선호도 규칙 (NUMERIC 등 나머지는 값 손실이 없도록 kText)
+        if ((static_cast<uint32_t>(columnIndex) == orderColumnIndex) || (upperDeclaredType.find("INT") != std::string::npos))
+        {
+            dataType = StmtDataType::kInteger;
+        }
+        else if ((upperDeclaredType.find("CHAR") != std::string::npos) ||
+            (upperDeclaredType.find("CLOB") != std::string::npos) ||
+            (upperDeclaredType.find("TEXT") != std::string::npos))
+        {
+            dataType = StmtDataType::kText;
+        }
+        else if (upperDeclaredType.find("BLOB") != std::string::npos)
+        {
+            dataType = StmtDataType::kBlob;
+        }
+        else if ((upperDeclaredType.find("REAL") != std::string::npos) ||
+            (upperDeclaredType.find("FLOA") != std::string::npos) ||
+            (upperDeclaredType.find("DOUB") != std::string::npos))
+        {
+            dataType = StmtDataType::kFloat;
+        }
+
+        columnBufferList.push_back(ColumnBuffer(static_cast<uint32_t>(columnIndex), dataType));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,465 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <queue>
+#include <algorithm>
+#include <cctype>
+
+namespace EzSqlite
+{
+
+const uint32_t kDefaultFanOutBatchRowCount = 1024;
+const uint32_t kDefaultFanOutQueuedBatchNumber = 4;
+
+struct FanOutOptions
+{
+    FanOutOptions()
+    {
+        columnsName = "*";
+        orderColumnName = "C_TimeStamp";
+        batchRowCount = kDefaultFanOutBatchRowCount;
+        maxQueuedBatchNumber = kDefaultFanOutQueuedBatchNumber;
+    };
+
+    std::string columnsName;        // 모든 테이블에 공통으로 사용할 SELECT 컬럼 목록
+    std::string orderColumnName;    // 병합 기준 컬럼 (정수), columnsName 결과에 같은 이름의 컬럼이 있어야 됨
+    uint32_t batchRowCount;
+    uint32_t maxQueuedBatchNumber;  // 테이블마다 병합되기 전에 미리 읽어둘 최대 batch 수
+};
+
+/*
+    ExecFanOutQuery에서 테이블 하나로부터 읽은 행 묶음
+    columnBufferList[n]은 n번 컬럼, 컬럼 타입은 선언 타입으로 결정 (INT -> kInteger, REAL/FLOA/DOUB -> kFloat, BLOB -> kBlob, 그 외 kText)
+*/
+struct FanOutBatch
+{
+    FanOutBatch()
+    {
+        rowCount = 0;
+    };
+
+    std::vector<ColumnBuffer> columnBufferList;
+    uint32_t rowCount;
+};
+
+// ConnectionPool::PrepareStmt로 등록된 명령문 핸들 (모든 연결에서 공통으로 사용)
+struct PoolStmtHandle
+{
+    PoolStmtHandle()
+    {
+        index = static_cast<uint32_t>(-1);
+    };
+
+    uint32_t index;     // 등록 순서, -1이면 유효하지 않은 핸들
+};
+
+struct ConnectionPoolStatistics
+{
+    ConnectionPoolStatistics()
+    {
+        readerCount = 0;
+        freeReaderCount = 0;
+        readerAcquireCount = 0;
+        readerWaitCount = 0;
+        readerTimeOutCount = 0;
+        totalReaderWaitMicroseconds = 0;
+        writerAcquireCount = 0;
+        writerWaitCount = 0;
+        mirroredPrepareCount = 0;
+    };
+
+    uint32_t readerCount;
+    uint32_t freeReaderCount;
+    uint64_t readerAcquireCount;
+    uint64_t readerWaitCount;           // 사용 가능한 읽기 연결이 없어서 대기한 횟수
+    uint64_t readerTimeOutCount;
+    uint64_t totalReaderWaitMicroseconds;
+    uint64_t writerAcquireCount;
+    uint64_t writerWaitCount;
+    uint64_t mirroredPrepareCount;      // 각 연결에서 실제로 Prepare된 등록 명령문 수
+};
+
+class ConnectionPool;
+
+/*
+    ConnectionPool에서 빌린 연결 하나 (소멸 시 반납)
+    빌린 동안에는 해당 연결을 혼자 사용하므로 스레드 간 동기화 없이 SqliteManager 함수를 호출할 수 있음
+*/
+class ConnectionLease
+{
+public:
+    ConnectionLease(ConnectionLease&& other);
+    ~ConnectionLease();
+
+    ConnectionLease(const ConnectionLease&) = delete;
+    ConnectionLease& operator=(const ConnectionLease&) = delete;
+    ConnectionLease& operator=(ConnectionLease&&) = delete;
+
+    // 대기 시간 초과, Close 이후에는 false
+    bool IsValid() const
+    {
+        return connection_ != nullptr;
+    }
+
+    SqliteManager& operator*() const;
+    SqliteManager* operator->() const;
+
+    // 이 연결에서 아직 Prepare되지 않은 등록 명령문이면 이 시점에 Prepare
+    Errors GetStmtHandle(_In_ PoolStmtHandle poolStmtHandle, _Out_ StmtHandle& stmtHandle);
+
+    void Release();
+
+private:
+    friend class ConnectionPool;
+
+    struct Connection;
+
+    ConnectionLease(_In_opt_ ConnectionPool* connectionPool, _In_opt_ Connection* connection);
+
+private:
+    ConnectionPool* connectionPool_;
+    Connection* connection_;
+};
+
+/*
+    쓰기 연결 1개 + WAL 모드 읽기 전용 연결 N개
+    WAL 모드에서는 읽기가 쓰기를 막지 않으므로, 조회는 비어있는 읽기 연결에서 수집(쓰기)과 동시에 실행됨
+
+    PrepareStmt로 등록한 명령문은 모든 연결에서 같은 PoolStmtHandle로 사용
+    (각 연결은 자신의 SqliteManager에 명령문을 따로 Prepare하며, 처음 사용될 때 Prepare)
+    등록된 명령문은 Close 이후에도 제거되지 않으므로 고정된 명령문만 등록해야 됨 (조회마다 달라지는 명령문 등록 금지)
+
+    Close는 빌려간 연결이 모두 반납된 상태에서 호출해야 됨
+*/
+class ConnectionPool
+{
+public:
+    ConnectionPool();
+    ~ConnectionPool();
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    // 쓰기 연결은 SqliteManager::CreateDatabase와 같은 규칙으로 열고 journal_mode를 WAL로 변경
+    // openOptions는 모든 연결에 적용 (locking_mode=EXCLUSIVE는 읽기 연결을 막으므로 사용하면 안 됨)
+    Errors Open(
+        _In_ const std::wstring& databasePath,
+        _In_ CreationDisposition creationDisposition,
+        _In_ uint32_t readerCount,
+        _In_opt_ FPDataChangeNotificationCallback dataChangeNotificationCallback,
+        _In_opt_ void* dataChangeNotificationCallbackUserContext,
+        _In_ const std::vector<std::string>& verifyTableStmtStringList,
+        _In_opt_ const std::vector<std::string>* createTableStmtStringList = nullptr,
+        _In_opt_ const OpenOptions* openOptions = nullptr
+    );
+    Errors Close();
+
+    // Open 전후 언제든 등록 가능, 이미 등록된 명령문이면 기존 핸들 리턴
+    Errors PrepareStmt(_In_ const std::string& stmtString, _In_opt_ uint32_t prepareFlags, _Out_ PoolStmtHandle& poolStmtHandle);
+
+    // timeOutMilliseconds가 0이면 무한 대기, 실패 시 IsValid가 false인 lease 리턴
+    ConnectionLease AcquireReader(_In_opt_ uint32_t timeOutMilliseconds = 0);
+    ConnectionLease AcquireWriter();
+
+    // 읽기 연결을 빌려서 ExecStmtWithParameters 실행
+    template <typename StepCallback, typename... Params>
+    Errors ExecQuery(
+        _In_ PoolStmtHandle poolStmtHandle,
+        _In_opt_ StepCallback&& stmtStepCallback,
+        _In_ const Params&... params
+    );
+
+    /*
+        tableNameList의 테이블마다 "SELECT columnsName FROM 테이블 WHERE predicateString ORDER BY orderColumnName;"을
+        테이블별 스레드에서 서로 다른 읽기 연결로 동시에 실행하고, 결과를 orderColumnName 순서로 k-way 병합해서 fanOutCallback 호출
+
+        fanOutCallback: CallbackErrors(uint32_t tableIndex, const FanOutBatch& fanOutBatch, uint32_t rowIndex)
+        orderColumnName 값이 같으면 tableNameList 순서
+        orderColumnName은 결과 컬럼 이름(AS로 지정한 경우 그 이름)에서 찾으며, 없으면 kNotFound 리턴
+        파라미터 Bind 규칙은 Query와 동일하며 모든 테이블에 같은 값을 Bind
+
+        테이블별 명령문은 PrepareStmt로 등록하지 않고 해당 읽기 연결에서 Prepare한 뒤 조회가 끝나면 Finalize
+        (predicateString마다 명령문이 달라지므로 등록 목록과 연결별 명령문이 계속 늘어나지 않도록 함)
+
+        읽기 연결이 테이블 수 이상이면 테이블 수만큼의 연결을 한 번에 확보한 뒤 시작 (동시에 실행된 ExecFanOutQuery끼리 교착 방지)
+        읽기 연결 수가 테이블 수보다 적으면 먼저 연결을 얻은 테이블의 결과를 모두 읽어둔 뒤 연결을 반납하므로
+        maxQueuedBatchNumber 제한이 적용되지 않음
+    */
+    template <typename FanOutCallback, typename... Params>
+    Errors ExecFanOutQuery(
+        _In_ const std::vector<std::string>& tableNameList,
+        _In_ const std::string& predicateString,
+        _In_ const FanOutOptions& fanOutOptions,
+        _In_ FanOutCallback&& fanOutCallback,
+        _In_ const Params&... params
+    );
+
+    void GetStatistics(_Out_ ConnectionPoolStatistics& connectionPoolStatistics);
+
+private:
+    friend class ConnectionLease;
+
+    struct PoolStmtInfo
+    {
+        PoolStmtInfo()
+        {
+            stmtStringHash = 0;
+            prepareFlags = 0;
+        };
+
+        std::string stmtString;
+        uint64_t stmtStringHash;
+        uint32_t prepareFlags;
+    };
+
+    Errors OpenConnections_(
+        _In_ const std::wstring& databasePath,
+        _In_ CreationDisposition creationDisposition,
+        _In_ uint32_t readerCount,
+        _In_opt_ FPDataChangeNotificationCallback dataChangeNotificationCallback,
+        _In_opt_ void* dataChangeNotificationCallbackUserContext,
+        _In_ const std::vector<std::string>& verifyTableStmtStringList,
+        _In_opt_ const std::vector<std::string>* createTableStmtStringList,
+        _In_opt_ const OpenOptions* openOptions
+    );
+    // 테이블 하나의 결과를 읽는 스레드와 병합 스레드 사이의 batch 큐
+    struct FanOutStream
+    {
+        FanOutStream()
+        {
+            finished = false;
+            status = Errors::kUnsuccess;
+            orderColumnIndex = 0;
+        };
+
+        std::mutex mutex;
+        std::condition_variable conditionVariable;
+        std::deque<std::unique_ptr<FanOutBatch>> batchQueue;
+        std::vector<std::unique_ptr<FanOutBatch>> freeBatchList;   // 병합이 끝난 batch (버퍼 용량 재사용)
+        bool finished;
+        Errors status;
+        uint32_t orderColumnIndex;      // 결과 컬럼에서 orderColumnName의 위치 (첫 batch를 넣기 전에 RunFanOutStream_에서 설정)
+        std::unique_ptr<ConnectionLease> connectionLease;  // 미리 확보한 읽기 연결 (nullptr이면 스레드에서 AcquireReader)
+        std::thread workerThread;
+    };
+
+    typedef std::function<ResultCursor(SqliteManager& sqliteManager, StmtHandle stmtHandle)> OpenCursorFunc;
+
+    Errors StartFanOutStreams_(
+        _In_ const std::vector<std::string>& stmtStringList,
+        _In_ const FanOutOptions& fanOutOptions,
+        _In_ const OpenCursorFunc& openCursor,
+        _Inout_ std::atomic<bool>& cancelled,
+        _Out_ std::vector<std::unique_ptr<FanOutStream>>& fanOutStreamList
+    );
+    void StopFanOutStreams_(_Inout_ std::vector<std::unique_ptr<FanOutStream>>& fanOutStreamList, _Inout_ std::atomic<bool>& cancelled);
+    void RunFanOutStream_(
+        _Inout_ FanOutStream& fanOutStream,
+        _In_ const std::string& stmtString,
+        _In_ const FanOutOptions& fanOutOptions,
+        _In_ bool boundedQueue,
+        _In_ const OpenCursorFunc& openCursor,
+        _In_ const std::atomic<bool>& cancelled
+    );
+    static std::unique_ptr<FanOutBatch> PopFanOutBatch_(_Inout_ FanOutStream& fanOutStream, _Out_ Errors& streamStatus);
+    static void RecycleFanOutBatch_(_Inout_ FanOutStream& fanOutStream, _In_ std::unique_ptr<FanOutBatch> fanOutBatch);
+    static Errors FindFanOutOrderColumn_(_In_ sqlite3_stmt* stmt, _In_ const std::string& orderColumnName, _Out_ uint32_t& orderColumnIndex);
+    static void GetFanOutColumnLayout_(_In_ sqlite3_stmt* stmt, _In_ uint32_t orderColumnIndex, _Out_ std::vector<ColumnBuffer>& columnBufferList);
+
+    void ReleaseConnection_(_In_ ConnectionLease::Connection* connection);
+    Errors GetStmtHandle_(_In_ ConnectionLease::Connection& connection, _In_ PoolStmtHandle poolStmtHandle, _Out_ StmtHandle& stmtHandle);
+
+private:
+    std::unique_ptr<ConnectionLease::Connection> writerConnection_;
+    std::vector<std::unique_ptr<ConnectionLease::Connection>> readerConnectionList_;
+
+    // 사용 가능한 읽기 연결 (최근에 반납된 연결을 먼저 사용해서 페이지 캐시 재사용)
+    std::vector<ConnectionLease::Connection*> freeReaderConnectionList_;
+    bool writerInUse_;
+    std::mutex connectionMutex_;
+    std::condition_variable connectionConditionVariable_;
+
+    // 주소가 바뀌지 않도록 deque 사용
+    std::deque<PoolStmtInfo> poolStmtInfoList_;
+    // stmtStringHash -> poolStmtInfoList_ Index (해시 충돌 시 같은 키에 여러 Index가 존재)
+    std::unordered_multimap<uint64_t, uint32_t> poolStmtIndexMap_;
+    std::mutex poolStmtInfoListMutex_;
+
+    ConnectionPoolStatistics connectionPoolStatistics_;
+};
+
+// SqliteManager 하나와 해당 연결에서 Prepare된 등록 명령문 핸들 목록
+struct ConnectionLease::Connection
+{
+    SqliteManager sqliteManager;
+    std::vector<StmtHandle> stmtHandleList;     // PoolStmtHandle::index -> 이 연결의 StmtHandle (generation 0이면 아직 Prepare 안 됨)
+};
+
+template <typename StepCallback, typename... Params>
+Errors ConnectionPool::ExecQuery(
+    _In_ PoolStmtHandle poolStmtHandle,
+    _In_opt_ StepCallback&& stmtStepCallback,
+    _In_ const Params&... params
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    StmtHandle stmtHandle;
+    ConnectionLease connectionLease = AcquireReader();
+
+    if (connectionLease.IsValid() == false)
+    {
+        return retValue;
+    }
+
+    retValue = connectionLease.GetStmtHandle(poolStmtHandle, stmtHandle);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = connectionLease->ExecStmtWithParameters(stmtHandle, std::forward<StepCallback>(stmtStepCallback), params...);
+    return retValue;
+}
+
+template <typename FanOutCallback, typename... Params>
+Errors ConnectionPool::ExecFanOutQuery(
+    _In_ const std::vector<std::string>& tableNameList,
+    _In_ const std::string& predicateString,
+    _In_ const FanOutOptions& fanOutOptions,
+    _In_ FanOutCallback&& fanOutCallback,
+    _In_ const Params&... params
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const uint32_t tableCount = static_cast<uint32_t>(tableNameList.size());
+    std::vector<std::string> stmtStringList;
+    std::vector<std::unique_ptr<FanOutStream>> fanOutStreamList;
+    std::atomic<bool> cancelled(false);
+
+    // 테이블별 현재 병합 중인 batch와 행 위치
+    std::vector<std::unique_ptr<FanOutBatch>> currentBatchList(tableCount);
+    std::vector<uint32_t> currentRowIndexList(tableCount, 0);
+    Errors streamStatus = Errors::kUnsuccess;
+    uint64_t mergedRowCount = 0;
+
+    // (orderColumnName 값, tableIndex) 최소 힙
+    typedef std::pair<int64_t, uint32_t> MergeKey;
+    std::priority_queue<MergeKey, std::vector<MergeKey>, std::greater<MergeKey>> mergeHeap;
+
+    CallbackErrors callbackStatus = CallbackErrors::kContinue;
+
+    // params는 모든 스레드가 종료된 후 리턴되므로 참조로 전달 (스레드보다 먼저 소멸되지 않도록 raii 앞에 선언)
+    OpenCursorFunc openCursor = [&](SqliteManager& sqliteManager, StmtHandle stmtHandle)
+    {
+        return sqliteManager.Query(stmtHandle, params...);
+    };
+
+    auto raii = RAIIRegister([&]
+        {
+            StopFanOutStreams_(fanOutStreamList, cancelled);
+        });
+
+    if (tableCount == 0)
+    {
+        return retValue;
+    }
+
+    for (const auto& tableNameListEntry : tableNameList)
+    {
+        stmtStringList.push_back(
+            "SELECT " + fanOutOptions.columnsName +
+            " FROM " + tableNameListEntry +
+            " WHERE " + predicateString +
+            " ORDER BY " + fanOutOptions.orderColumnName + ";"
+        );
+    }
+
+    retValue = StartFanOutStreams_(
+        stmtStringList,
+        fanOutOptions,
+        openCursor,
+        cancelled,
+        fanOutStreamList
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (uint32_t tableIndex = 0; tableIndex < tableCount; tableIndex++)
+    {
+        currentBatchList[tableIndex] = PopFanOutBatch_(*fanOutStreamList[tableIndex], streamStatus);
+        if (currentBatchList[tableIndex] == nullptr)
+        {
+            if (streamStatus != Errors::kSuccess)
+            {
+                retValue = streamStatus;
+                return retValue;
+            }
+            continue;
+        }
+
+        mergeHeap.push(MergeKey(currentBatchList[tableIndex]->columnBufferList[fanOutStreamList[tableIndex]->orderColumnIndex].integerList[0], tableIndex));
+    }
+
+    while (mergeHeap.empty() == false)
+    {
+        const uint32_t tableIndex = mergeHeap.top().second;
+        mergeHeap.pop();
+
+        callbackStatus = fanOutCallback(tableIndex, static_cast<const FanOutBatch&>(*currentBatchList[tableIndex]), currentRowIndexList[tableIndex]);
+        if (callbackStatus == CallbackErrors::kStop)
+        {
+            retValue = Errors::kStopCallback;
+            return retValue;
+        }
+        else if (callbackStatus == CallbackErrors::kFail)
+        {
+            retValue = Errors::kFailCallback;
+            return retValue;
+        }
+        mergedRowCount++;
+
+        currentRowIndexList[tableIndex]++;
+        if (currentRowIndexList[tableIndex] == currentBatchList[tableIndex]->rowCount)
+        {
+            RecycleFanOutBatch_(*fanOutStreamList[tableIndex], std::move(currentBatchList[tableIndex]));
+            currentRowIndexList[tableIndex] = 0;
+
+            currentBatchList[tableIndex] = PopFanOutBatch_(*fanOutStreamList[tableIndex], streamStatus);
+            if (currentBatchList[tableIndex] == nullptr)
+            {
+                if (streamStatus != Errors::kSuccess)
+                {
+                    retValue = streamStatus;
+                    return retValue;
+                }
+                continue;
+            }
+        }
+
+        mergeHeap.push(MergeKey(
+            currentBatchList[tableIndex]->columnBufferList[fanOutStreamList[tableIndex]->orderColumnIndex].integerList[currentRowIndexList[tableIndex]],
+            tableIndex
+        ));
+    }
+
+    if (mergedRowCount == 0)
+    {
+        retValue = Errors::kNoResult;
+    }
+    else
+    {
+        retValue = Errors::kSuccess;
+    }
+
+    return retValue;
+}
+
+} // namespace EzSqlite
\ No newline at end of file
@@ -0,0 +1,516 @@
+#pragma once
+
+#include "BatchWriter.h"
+
+#include <atomic>
+#include <thread>
+#include <memory>
+
+namespace EzSqlite
+{
+
+const uint32_t kDefaultIngestQueueCapacity = 64 * 1024;
+const uint32_t kDefaultIngestIdleWaitMilliseconds = 10;
+
+// 큐가 가득 찼을 때 Push 처리 방식
+enum class BackpressurePolicy
+{
+    kBlock,         // 빈 자리가 생길 때까지 대기 (blockTimeOutMilliseconds 초과 시 버림)
+    kDropOldest,    // 가장 오래된 레코드를 버리고 추가
+    kDropNewest     // 추가하려는 레코드를 버림
+};
+
+struct IngestQueueOptions
+{
+    IngestQueueOptions()
+    {
+        capacity = kDefaultIngestQueueCapacity;
+        backpressurePolicy = BackpressurePolicy::kBlock;
+        blockTimeOutMilliseconds = 0;
+        idleWaitMilliseconds = kDefaultIngestIdleWaitMilliseconds;
+    };
+
+    uint32_t capacity;                  // 2의 거듭제곱으로 올림
+    BackpressurePolicy backpressurePolicy;
+    uint32_t blockTimeOutMilliseconds;  // kBlock 전용, 0이면 무한 대기
+    uint32_t idleWaitMilliseconds;      // 큐가 비었을 때 작성 스레드가 대기하는 최대 시간 (지연 시간 Commit 검사 주기)
+    BatchWriterOptions batchWriterOptions;
+};
+
+struct IngestQueueStatistics
+{
+    IngestQueueStatistics()
+    {
+        pushedCount = 0;
+        writtenCount = 0;
+        failedCount = 0;
+        droppedOldestCount = 0;
+        droppedNewestCount = 0;
+        blockedCount = 0;
+        queueDepth = 0;
+        maxQueueDepth = 0;
+        capacity = 0;
+    };
+
+    uint64_t pushedCount;           // 큐에 들어간 레코드 (kDropOldest로 나중에 버려진 레코드 포함)
+    uint64_t writtenCount;          // 작성 스레드에서 실행에 성공한 레코드
+    uint64_t failedCount;           // 작성 스레드에서 실행에 실패한 레코드
+    uint64_t droppedOldestCount;
+    uint64_t droppedNewestCount;    // kDropNewest, kBlock 대기 시간 초과, 중지 이후 Push
+    uint64_t blockedCount;          // kBlock으로 대기한 Push 횟수
+    uint32_t queueDepth;
+    uint32_t maxQueueDepth;
+    uint32_t capacity;
+    BatchWriterStatistics batchWriterStatistics;    // 작성 스레드의 마지막 Commit 기준
+};
+
+/*
+    여러 생산자 스레드가 Push한 레코드를 전용 작성 스레드 하나가 BatchWriter로 기록
+    (생산자는 SqliteManager를 사용하지 않으므로 외부 mutex 없이 동시에 Push 가능)
+
+    큐는 슬롯마다 sequence를 두는 고정 크기 lock-free ring buffer (Dmitry Vyukov의 bounded MPMC queue)
+    소비자는 작성 스레드 하나이고, kDropOldest인 경우에만 생산자가 가장 오래된 레코드를 꺼내서 버림
+
+    Record: 기본 생성, 이동 대입이 가능한 타입
+    writeRecord: 작성 스레드에서 레코드 하나를 기록 (보통 batchWriter.InsertWithParameters 호출)
+
+    Start 이후 Stop 전까지 sqliteManager는 작성 스레드 전용 (다른 스레드에서 사용하면 안 됨)
+    Stop은 큐에 남은 레코드를 모두 기록하고 Commit한 뒤 리턴 (Stop과 동시에 진행 중인 Push는 기록되지 않을 수 있으므로 생산자를 먼저 멈춰야 됨)
+*/
+template <typename Record>
+class IngestQueue
+{
+public:
+    typedef std::function<Errors(BatchWriter& batchWriter, const Record& record)> WriteRecordFunc;
+
+    IngestQueue(
+        _In_ SqliteManager& sqliteManager,
+        _In_ const WriteRecordFunc& writeRecord,
+        _In_opt_ const IngestQueueOptions& ingestQueueOptions = IngestQueueOptions()
+    );
+    ~IngestQueue();
+
+    IngestQueue(const IngestQueue&) = delete;
+    IngestQueue& operator=(const IngestQueue&) = delete;
+
+    Errors Start();
+    void Stop();
+
+    // 레코드를 버린 경우(kDropNewest, 대기 시간 초과, 중지 상태) kUnsuccess
+    Errors Push(_In_ const Record& record);
+    Errors Push(_In_ Record&& record);
+
+    void GetStatistics(_Out_ IngestQueueStatistics& ingestQueueStatistics);
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    Errors Push_(_Inout_ Record& record);
+    bool TryPush_(_Inout_ Record& record);
+    bool TryPop_(_Out_ Record& record);
+    void WriterThread_();
+    void UpdateMaxQueueDepth_();
+
+private:
+    SqliteManager& sqliteManager_;
+    WriteRecordFunc writeRecord_;
+    IngestQueueOptions ingestQueueOptions_;
+
+    std::unique_ptr<Slot[]> slotList_;
+    size_t slotIndexMask_;
+
+    // 생산자, 소비자 위치를 다른 캐시 라인에 배치 (false sharing 방지)
+    // alignas는 C++14에서 heap 할당 시 정렬이 보장되지 않으므로 padding 사용
+    char enqueuePositionPadding_[kCacheLineSize];
+    std::atomic<size_t> enqueuePosition_;
+    char dequeuePositionPadding_[kCacheLineSize - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> dequeuePosition_;
+    char runningPadding_[kCacheLineSize - sizeof(std::atomic<size_t>)];
+
+    std::atomic<bool> running_;
+    std::atomic<bool> stopRequested_;
+    std::thread writerThread_;
+
+    // 작성 스레드 대기 (큐가 빈 경우), 생산자 대기 (kBlock, 큐가 가득 찬 경우)
+    // 놓친 알림은 대기 시간 제한으로 복구되므로 Push 경로에서는 대기 중일 때만 mutex 사용
+    std::mutex writerMutex_;
+    std::condition_variable writerConditionVariable_;
+    std::atomic<bool> writerWaiting_;
+    std::mutex producerMutex_;
+    std::condition_variable producerConditionVariable_;
+    std::atomic<uint32_t> blockedProducerCount_;
+
+    std::atomic<uint64_t> pushedCount_;
+    std::atomic<uint64_t> writtenCount_;
+    std::atomic<uint64_t> failedCount_;
+    std::atomic<uint64_t> droppedOldestCount_;
+    std::atomic<uint64_t> droppedNewestCount_;
+    std::atomic<uint64_t> blockedCount_;
+    std::atomic<uint32_t> maxQueueDepth_;
+
+    std::mutex batchWriterStatisticsMutex_;
+    BatchWriterStatistics batchWriterStatistics_;
+};
+
+template <typename Record>
+IngestQueue<Record>::IngestQueue(
+    _In_ SqliteManager& sqliteManager,
+    _In_ const WriteRecordFunc& writeRecord,
+    _In_opt_ const IngestQueueOptions& ingestQueueOptions /*= IngestQueueOptions()*/
+) : sqliteManager_(sqliteManager), writeRecord_(writeRecord), ingestQueueOptions_(ingestQueueOptions)
+{
+    size_t capacity = 2;
+
+    while (capacity < ingestQueueOptions_.capacity)
+    {
+        capacity <<= 1;
+    }
+    ingestQueueOptions_.capacity = static_cast<uint32_t>(capacity);
+
+    slotList_.reset(new Slot[capacity]);
+    for (size_t slotIndex = 0; slotIndex < capacity; slotIndex++)
+    {
+        slotList_[slotIndex].sequence.store(slotIndex, std::memory_order_relaxed);
+    }
+    slotIndexMask_ = capacity - 1;
+
+    enqueuePosition_ = 0;
+    dequeuePosition_ = 0;
+    running_ = false;
+    stopRequested_ = false;
+    writerWaiting_ = false;
+    blockedProducerCount_ = 0;
+
+    pushedCount_ = 0;
+    writtenCount_ = 0;
+    failedCount_ = 0;
+    droppedOldestCount_ = 0;
+    droppedNewestCount_ = 0;
+    blockedCount_ = 0;
+    maxQueueDepth_ = 0;
+}
+
+template <typename Record>
+IngestQueue<Record>::~IngestQueue()
+{
+    this->Stop();
+}
+
+template <typename Record>
+Errors IngestQueue<Record>::Start()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    if (running_ == true)
+    {
+        return retValue;
+    }
+
+    stopRequested_ = false;
+    running_ = true;
+    writerThread_ = std::thread(&IngestQueue::WriterThread_, this);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+template <typename Record>
+void IngestQueue<Record>::Stop()
+{
+    if (writerThread_.joinable() == false)
+    {
+        return;
+    }
+
+    // 이후 Push는 실패, 작성 스레드는 남은 레코드를 모두 기록하고 종료
+    running_ = false;
+    stopRequested_ = true;
+    {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        writerConditionVariable_.notify_one();
+    }
+
+    writerThread_.join();
+}
+
+template <typename Record>
+Errors IngestQueue<Record>::Push(
+    _In_ const Record& record
+)
+{
+    Record recordCopy(record);
+
+    return Push_(recordCopy);
+}
+
+template <typename Record>
+Errors IngestQueue<Record>::Push(
+    _In_ Record&& record
+)
+{
+    return Push_(record);
+}
+
+template <typename Record>
+void IngestQueue<Record>::GetStatistics(
+    _Out_ IngestQueueStatistics& ingestQueueStatistics
+)
+{
+    size_t enqueuePosition = enqueuePosition_.load(std::memory_order_relaxed);
+    size_t dequeuePosition = dequeuePosition_.load(std::memory_order_relaxed);
+
+    ingestQueueStatistics.pushedCount = pushedCount_;
+    ingestQueueStatistics.writtenCount = writtenCount_;
+    ingestQueueStatistics.failedCount = failedCount_;
+    ingestQueueStatistics.droppedOldestCount = droppedOldestCount_;
+    ingestQueueStatistics.droppedNewestCount = droppedNewestCount_;
+    ingestQueueStatistics.blockedCount = blockedCount_;
+    ingestQueueStatistics.queueDepth = (enqueuePosition > dequeuePosition) ? static_cast<uint32_t>(enqueuePosition - dequeuePosition) : 0;
+    ingestQueueStatistics.maxQueueDepth = maxQueueDepth_;
+    ingestQueueStatistics.capacity = ingestQueueOptions_.capacity;
+
+    std::lock_guard<std::mutex> lock(batchWriterStatisticsMutex_);
+    ingestQueueStatistics.batchWriterStatistics = batchWriterStatistics_;
+}
+
+template <typename Record>
+Errors IngestQueue<Record>::Push_(
+    _Inout_ Record& record
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::chrono::steady_clock::time_point blockBeginTime;
+    bool blocked = false;
+    Record droppedRecord;
+
+    if (running_.load(std::memory_order_relaxed) == false)
+    {
+        droppedNewestCount_++;
+        return retValue;
+    }
+
+    while (TryPush_(record) == false)
+    {
+        if (ingestQueueOptions_.backpressurePolicy == BackpressurePolicy::kDropNewest)
+        {
+            droppedNewestCount_++;
+            return retValue;
+        }
+        else if (ingestQueueOptions_.backpressurePolicy == BackpressurePolicy::kDropOldest)
+        {
+            // 그 사이 작성 스레드가 꺼내갔으면 버리지 않고 다시 시도
+            if (TryPop_(droppedRecord) == true)
+            {
+                droppedOldestCount_++;
+            }
+            continue;
+        }
+
+        if (blocked == false)
+        {
+            blocked = true;
+            blockBeginTime = std::chrono::steady_clock::now();
+            blockedCount_++;
+        }
+
+        if (((ingestQueueOptions_.blockTimeOutMilliseconds != 0) &&
+            (std::chrono::steady_clock::now() - blockBeginTime >= std::chrono::milliseconds(ingestQueueOptions_.blockTimeOutMilliseconds))) ||
+            (running_.load(std::memory_order_relaxed) == false))
+        {
+            droppedNewestCount_++;
+            return retValue;
+        }
+
+        std::unique_lock<std::mutex> lock(producerMutex_);
+        blockedProducerCount_++;
+        producerConditionVariable_.wait_for(lock, std::chrono::milliseconds(1));
+        blockedProducerCount_--;
+    }
+
+    pushedCount_.fetch_add(1, std::memory_order_relaxed);
+    UpdateMaxQueueDepth_();
+
+    if (writerWaiting_ == true)
+    {
+        std::lock_guard<std::mutex> lock(writerMutex_);
+        writerConditionVariable_.notify_one();
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+template <typename Record>
+bool IngestQueue<Record>::TryPush_(
+    _Inout_ Record& record
+)
+{
+    Slot* slot = nullptr;
+    size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        slot = &slotList_[position & slotIndexMask_];
+
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        // sequence == position 이면 비어있는 슬롯, 작으면 한 바퀴 전 레코드가 아직 남아있음 (가득 참)
+        if (difference == 0)
+        {
+            if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = enqueuePosition_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->record = std::move(record);
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename Record>
+bool IngestQueue<Record>::TryPop_(
+    _Out_ Record& record
+)
+{
+    Slot* slot = nullptr;
+    size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        slot = &slotList_[position & slotIndexMask_];
+
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+        // sequence == position + 1 이면 레코드가 들어있는 슬롯, 작으면 비어있음
+        if (difference == 0)
+        {
+            if (dequeuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = dequeuePosition_.load(std::memory_order_relaxed);
+        }
+    }
+
+    record = std::move(slot->record);
+    slot->sequence.store(position + slotIndexMask_ + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename Record>
+void IngestQueue<Record>::WriterThread_()
+{
+    BatchWriter batchWriter(sqliteManager_, ingestQueueOptions_.batchWriterOptions);
+    Record record;
+    uint32_t poppedCount = 0;
+
+    while (true)
+    {
+        // 생산자가 대기하지 않도록 한 번에 큐 용량까지만 꺼냄
+        for (poppedCount = 0; poppedCount < ingestQueueOptions_.capacity; poppedCount++)
+        {
+            if (TryPop_(record) == false)
+            {
+                break;
+            }
+
+            if (writeRecord_(batchWriter, record) == Errors::kSuccess)
+            {
+                writtenCount_.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                failedCount_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if ((blockedProducerCount_.load(std::memory_order_relaxed) != 0) && ((poppedCount & 0xFF) == 0))
+            {
+                std::lock_guard<std::mutex> lock(producerMutex_);
+                producerConditionVariable_.notify_all();
+            }
+        }
+
+        if (poppedCount != 0)
+        {
+            if (blockedProducerCount_ != 0)
+            {
+                std::lock_guard<std::mutex> lock(producerMutex_);
+                producerConditionVariable_.notify_all();
+            }
+            continue;
+        }
+
+        batchWriter.FlushIfExpired();
+        {
+            std::lock_guard<std::mutex> lock(batchWriterStatisticsMutex_);
+            batchWriter.GetStatistics(batchWriterStatistics_);
+        }
+
+        if (stopRequested_ == true)
+        {
+            // Stop 이전에 TryPush_가 끝난 레코드가 sequence 기록 전이면 아직 꺼낼 수 없으므로 한 번 더 확인
+            if (enqueuePosition_.load() == dequeuePosition_.load())
+            {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(writerMutex_);
+        writerWaiting_ = true;
+        if ((enqueuePosition_.load() == dequeuePosition_.load()) && (stopRequested_ == false))
+        {
+            writerConditionVariable_.wait_for(lock, std::chrono::milliseconds(ingestQueueOptions_.idleWaitMilliseconds));
+        }
+        writerWaiting_ = false;
+    }
+
+    batchWriter.Flush();
+
+    std::lock_guard<std::mutex> lock(batchWriterStatisticsMutex_);
+    batchWriter.GetStatistics(batchWriterStatistics_);
+}
+
+template <typename Record>
+void IngestQueue<Record>::UpdateMaxQueueDepth_()
+{
+    size_t enqueuePosition = enqueuePosition_.load(std::memory_order_relaxed);
+    size_t dequeuePosition = dequeuePosition_.load(std::memory_order_relaxed);
+    uint32_t queueDepth = (enqueuePosition > dequeuePosition) ? static_cast<uint32_t>(enqueuePosition - dequeuePosition) : 0;
+    uint32_t maxQueueDepth = maxQueueDepth_.load(std::memory_order_relaxed);
+
+    while ((queueDepth > maxQueueDepth) &&
+        (maxQueueDepth_.compare_exchange_weak(maxQueueDepth, queueDepth, std::memory_order_relaxed) == false))
+    {
+
+    }
+}
+
+} // namespace EzSqlite
\ No newline at end of file
@@ -0,0 +1,427 @@
+#include "PartitionedTable.h"
+
+EzSqlite::PartitionedTable::PartitionedTable(
+    _In_ SqliteManager& sqliteManager,
+    _In_ const PartitionedTableOptions& partitionedTableOptions
+) : sqliteManager_(sqliteManager)
+{
+    partitionedTableOptions_ = partitionedTableOptions;
+    partitionListTableName_ = partitionedTableOptions.tableName + "_PARTITION";
+    opened_ = false;
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::Open()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::map<uint64_t, PartitionInfo> partitionInfoMap;
+
+    StepCallbackFunc stepCallback = [&](const StmtInfo& stmtInfo)->CallbackErrors
+    {
+        ResultRow resultRow(stmtInfo.stmt);
+        PartitionInfo partitionInfo;
+
+        partitionInfo.beginTimeStamp = resultRow.Get<uint64_t>(0);
+        partitionInfo.endTimeStamp = resultRow.Get<uint64_t>(1);
+        partitionInfo.partitionTableName = resultRow.Get<std::string>(2);
+        partitionInfoMap.emplace(partitionInfo.beginTimeStamp, std::move(partitionInfo));
+
+        return CallbackErrors::kContinue;
+    };
+
+    retValue = sqliteManager_.ExecStmt(
+        "CREATE TABLE IF NOT EXISTS " + partitionListTableName_ +
+        "(C_BeginTimeStamp INTEGER PRIMARY KEY, C_EndTimeStamp INTEGER NOT NULL, C_TableName TEXT NOT NULL);"
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = sqliteManager_.ExecStmt(
+        "SELECT C_BeginTimeStamp, C_EndTimeStamp, C_TableName FROM " + partitionListTableName_ + ";",
+        nullptr,
+        &stepCallback
+    );
+    if ((retValue != Errors::kSuccess) && (retValue != Errors::kNoResult))
+    {
+        return retValue;
+    }
+
+    partitionInfoMap_.swap(partitionInfoMap);
+    opened_ = true;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::AcquirePartition(
+    _In_ uint64_t timeStamp,
+    _Out_ std::string& partitionTableName
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    uint64_t partitionBeginTimeStamp = GetPartitionBeginTimeStamp_(timeStamp);
+
+    if (opened_ == false)
+    {
+        return retValue;
+    }
+
+    auto partitionInfoEntry = partitionInfoMap_.find(partitionBeginTimeStamp);
+    if (partitionInfoEntry != partitionInfoMap_.end())
+    {
+        partitionTableName = partitionInfoEntry->second.partitionTableName;
+
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    return CreatePartition_(partitionBeginTimeStamp, partitionTableName);
+}
+
+void EzSqlite::PartitionedTable::GetPartitionList(
+    _In_ uint64_t beginTimeStamp,
+    _In_ uint64_t endTimeStamp,
+    _Out_ std::vector<PartitionInfo>& partitionInfoList
+)
+{
+    partitionInfoList.clear();
+
+    // 이전 실행에서 다른 partitionInterval로 만들어진 파티션이 있을 수 있으므로 구간 끝으로 겹침 여부 판단
+    for (const auto& partitionInfoEntry : partitionInfoMap_)
+    {
+        const PartitionInfo& partitionInfo = partitionInfoEntry.second;
+
+        if (endTimeStamp < partitionInfo.beginTimeStamp)
+        {
+            break;
+        }
+
+        if (beginTimeStamp < partitionInfo.endTimeStamp)
+        {
+            partitionInfoList.push_back(partitionInfo);
+        }
+    }
+}
+
+void EzSqlite::PartitionedTable::GetPartitionList(
+    _Out_ std::vector<PartitionInfo>& partitionInfoList
+)
+{
+    partitionInfoList.clear();
+
+    for (const auto& partitionInfoEntry : partitionInfoMap_)
+    {
+        partitionInfoList.push_back(partitionInfoEntry.second);
+    }
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::BuildRangeQuery(
+    _In_ const std::string& columnsName,
+    _In_ uint64_t beginTimeStamp,
+    _In_ uint64_t endTimeStamp,
+    _Out_ std::string& stmtString
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::vector<PartitionInfo> partitionInfoList;
+
+    GetPartitionList(beginTimeStamp, endTimeStamp, partitionInfoList);
+    if (partitionInfoList.size() == 0)
+    {
+        retValue = Errors::kNotFound;
+        return retValue;
+    }
+
+    stmtString.clear();
+    for (const auto& partitionInfo : partitionInfoList)
+    {
+        if (stmtString.length() != 0)
+        {
+            stmtString += " UNION ALL ";
+        }
+
+        stmtString += "SELECT " + columnsName + " FROM " + partitionInfo.partitionTableName +
+            " WHERE " + partitionedTableOptions_.timeStampColumnName + " >= ?1 AND " +
+            partitionedTableOptions_.timeStampColumnName + " <= ?2";
+    }
+    stmtString += ";";
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::ExecRangeQuery(
+    _In_ const std::string& columnsName,
+    _In_ uint64_t beginTimeStamp,
+    _In_ uint64_t endTimeStamp,
+    _In_opt_ StepCallbackFunc* stmtStepCallback
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::string stmtString;
+    int64_t timeStampList[] = { static_cast<int64_t>(beginTimeStamp), static_cast<int64_t>(endTimeStamp) };
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(_countof(timeStampList));
+
+    retValue = BuildRangeQuery(columnsName, beginTimeStamp, endTimeStamp, stmtString);
+    if (retValue == Errors::kNotFound)
+    {
+        retValue = Errors::kNoResult;
+        return retValue;
+    }
+    else if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (uint32_t timeStampIndex = 0; timeStampIndex < _countof(timeStampList); timeStampIndex++)
+    {
+        stmtBindParameterInfoList[timeStampIndex].data = &timeStampList[timeStampIndex];
+        stmtBindParameterInfoList[timeStampIndex].dataType = StmtDataType::kInteger;
+        stmtBindParameterInfoList[timeStampIndex].dataByteSize = sizeof(int64_t);
+        stmtBindParameterInfoList[timeStampIndex].options = StmtBindParameterOptions::kSigned;
+    }
+
+    return sqliteManager_.ExecStmt(stmtString, &stmtBindParameterInfoList, stmtStepCallback);
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::DropPartitionsBefore(
+    _In_ uint64_t timeStamp,
+    _Out_opt_ uint32_t* droppedPartitionCount /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    uint32_t dropCount = 0;
+
+    auto raii = RAIIRegister([&]
+        {
+            if (droppedPartitionCount != nullptr)
+            {
+                *droppedPartitionCount = dropCount;
+            }
+        });
+
+    if (opened_ == false)
+    {
+        return retValue;
+    }
+
+    for (auto partitionInfoEntry = partitionInfoMap_.begin(); partitionInfoEntry != partitionInfoMap_.end();)
+    {
+        if (partitionInfoEntry->second.endTimeStamp > timeStamp)
+        {
+            ++partitionInfoEntry;
+            continue;
+        }
+
+        retValue = DropPartition_(partitionInfoEntry->second);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        partitionInfoEntry = partitionInfoMap_.erase(partitionInfoEntry);
+        dropCount++;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+uint64_t EzSqlite::PartitionedTable::GetPartitionBeginTimeStamp_(
+    _In_ uint64_t timeStamp
+)
+{
+    return timeStamp - (timeStamp % GetPartitionTicks_());
+}
+
+uint64_t EzSqlite::PartitionedTable::GetPartitionTicks_()
+{
+    return (partitionedTableOptions_.partitionInterval == PartitionInterval::kHourly) ? kFileTimeTicksPerHour : kFileTimeTicksPerDay;
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::GetPartitionTableName_(
+    _In_ uint64_t beginTimeStamp,
+    _Out_ std::string& partitionTableName
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    FILETIME fileTime;
+    SYSTEMTIME systemTime;
+    char partitionSuffix[32] = { 0, };
+
+    fileTime.dwLowDateTime = static_cast<DWORD>(beginTimeStamp & 0xFFFFFFFF);
+    fileTime.dwHighDateTime = static_cast<DWORD>(beginTimeStamp >> 32);
+    if (FileTimeToSystemTime(&fileTime, &systemTime) == FALSE)
+    {
+        return retValue;
+    }
+
+    if (partitionedTableOptions_.partitionInterval == PartitionInterval::kHourly)
+    {
+        sprintf_s(partitionSuffix, "_P%04u%02u%02u%02u", systemTime.wYear, systemTime.wMonth, systemTime.wDay, systemTime.wHour);
+    }
+    else
+    {
+        sprintf_s(partitionSuffix, "_P%04u%02u%02u", systemTime.wYear, systemTime.wMonth, systemTime.wDay);
+    }
+
+    partitionTableName = partitionedTableOptions_.tableName + partitionSuffix;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::CreatePartition_(
+    _In_ uint64_t beginTimeStamp,
+    _Out_ std::string& partitionTableName
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    PartitionInfo partitionInfo;
+    int64_t endTimeStamp = 0;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(3);
+    bool inSavepoint = false;
+
+    // 파티션 테이블, 인덱스, 목록 기록을 하나의 SAVEPOINT로 처리 (호출자의 트랜잭션 안에서도 사용 가능)
+    auto raii = RAIIRegister([&]
+        {
+            if (inSavepoint == true)
+            {
+                if (retValue != Errors::kSuccess)
+                {
+                    sqliteManager_.ExecStmt("ROLLBACK TO PARTITION_CREATE;");
+                }
+                sqliteManager_.ExecStmt("RELEASE PARTITION_CREATE;");
+            }
+        });
+
+    partitionInfo.beginTimeStamp = beginTimeStamp;
+    partitionInfo.endTimeStamp = beginTimeStamp + GetPartitionTicks_();
+    retValue = GetPartitionTableName_(beginTimeStamp, partitionInfo.partitionTableName);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = sqliteManager_.ExecStmt("SAVEPOINT PARTITION_CREATE;");
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+    inSavepoint = true;
+
+    retValue = sqliteManager_.ExecStmt(
+        "CREATE TABLE IF NOT EXISTS " + partitionInfo.partitionTableName + "(" + partitionedTableOptions_.columnsDefinition + ");"
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    if (partitionedTableOptions_.createTimeStampIndex == true)
+    {
+        retValue = sqliteManager_.ExecStmt(
+            "CREATE INDEX IF NOT EXISTS " + partitionInfo.partitionTableName + "_" + partitionedTableOptions_.timeStampColumnName +
+            " ON " + partitionInfo.partitionTableName + "(" + partitionedTableOptions_.timeStampColumnName + ");"
+        );
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    endTimeStamp = static_cast<int64_t>(partitionInfo.endTimeStamp);
+
+    stmtBindParameterInfoList[0].data = &beginTimeStamp;
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[0].dataByteSize = sizeof(int64_t);
+    stmtBindParameterInfoList[0].options = StmtBindParameterOptions::kSigned;
+
+    stmtBindParameterInfoList[1].data = &endTimeStamp;
+    stmtBindParameterInfoList[1].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[1].dataByteSize = sizeof(int64_t);
+    stmtBindParameterInfoList[1].options = StmtBindParameterOptions::kSigned;
+
+    stmtBindParameterInfoList[2].data = partitionInfo.partitionTableName.c_str();
+    stmtBindParameterInfoList[2].dataType = StmtDataType::kText;
+    stmtBindParameterInfoList[2].dataByteSize = static_cast<uint32_t>(partitionInfo.partitionTableName.length());
+
+    retValue = sqliteManager_.ExecStmt(
+        "INSERT OR REPLACE INTO " + partitionListTableName_ + "(C_BeginTimeStamp, C_EndTimeStamp, C_TableName) VALUES(?, ?, ?);",
+        &stmtBindParameterInfoList
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    partitionTableName = partitionInfo.partitionTableName;
+    partitionInfoMap_.emplace(beginTimeStamp, std::move(partitionInfo));
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::PartitionedTable::DropPartition_(
+    _In_ const PartitionInfo& partitionInfo
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int64_t beginTimeStamp = static_cast<int64_t>(partitionInfo.beginTimeStamp);
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(1);
+    bool inSavepoint = false;
+
+    auto raii = RAIIRegister([&]
+        {
+            if (inSavepoint == true)
+            {
+                if (retValue != Errors::kSuccess)
+                {
+                    sqliteManager_.ExecStmt("ROLLBACK TO PARTITION_DROP;");
+                }
+                sqliteManager_.ExecStmt("RELEASE PARTITION_DROP;");
+            }
+        });
+
+    // BulkInsert가 파티션마다 등록한 INSERT 명령문이 계속 쌓이지 않도록 제거
+    sqliteManager_.FinalizePreparedStmt("INSERT INTO " + partitionInfo.partitionTableName + "(");
+
+    retValue = sqliteManager_.ExecStmt("SAVEPOINT PARTITION_DROP;");
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+    inSavepoint = true;
+
+    retValue = sqliteManager_.ExecStmt("DROP TABLE IF EXISTS " + partitionInfo.partitionTableName + ";");
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    stmtBindParameterInfoList[0].data = &beginTimeStamp;
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[0].dataByteSize = sizeof(int64_t);
+    stmtBindParameterInfoList[0].options = StmtBindParameterOptions::kSigned;
+
+    retValue = sqliteManager_.ExecStmt(
+        "DELETE FROM " + partitionListTableName_ + " WHERE C_BeginTimeStamp = ?;",
+        &stmtBindParameterInfoList
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
\ No newline at end of file
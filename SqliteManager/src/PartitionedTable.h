@@ -0,0 +1,202 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+#include <map>
+
+namespace EzSqlite
+{
+
+// C_TimeStamp (FILETIME, 100ns 단위) 기준 파티션 크기
+const uint64_t kFileTimeTicksPerHour = 60ULL * 60 * 1000 * 1000 * 10;
+const uint64_t kFileTimeTicksPerDay = 24 * kFileTimeTicksPerHour;
+
+enum class PartitionInterval
+{
+    kHourly,
+    kDaily
+};
+
+struct PartitionedTableOptions
+{
+    PartitionedTableOptions()
+    {
+        timeStampColumnName = "C_TimeStamp";
+        partitionInterval = PartitionInterval::kDaily;
+        createTimeStampIndex = true;
+    };
+
+    std::string tableName;              // 파티션 이름은 tableName_PYYYYMMDD (kHourly는 tableName_PYYYYMMDDHH, UTC)
+    std::string columnsDefinition;      // 파티션 CREATE TABLE의 컬럼 정의 (예: "C_EUID INTEGER, C_TimeStamp INTEGER, ...")
+    std::string timeStampColumnName;
+    PartitionInterval partitionInterval;
+    bool createTimeStampIndex;          // 파티션마다 timeStampColumnName 인덱스 생성
+};
+
+struct PartitionInfo
+{
+    PartitionInfo()
+    {
+        beginTimeStamp = 0;
+        endTimeStamp = 0;
+    };
+
+    uint64_t beginTimeStamp;            // 포함
+    uint64_t endTimeStamp;              // 제외
+    std::string partitionTableName;
+};
+
+/*
+    하나의 이벤트 테이블을 시간 구간(hourly, daily)별 테이블로 나눠서 저장
+    파티션 목록은 tableName_PARTITION 테이블에 기록되며 Open에서 읽어옴
+
+    INSERT는 timeStamp가 속한 파티션으로 전달 (없으면 생성)
+    시간 범위 조회는 겹치는 파티션만 UNION ALL로 묶어서 실행
+    보존 기간이 지난 데이터는 DELETE 대신 파티션 테이블을 DROP (삭제할 행 수와 무관)
+    DROP된 테이블의 페이지는 freelist로 반환되며 파일 크기를 줄이려면 VACUUM, incremental_vacuum이 필요
+
+    SqliteManager와 마찬가지로 스레드에 안전하지 않음
+*/
+class PartitionedTable
+{
+public:
+    explicit PartitionedTable(_In_ SqliteManager& sqliteManager, _In_ const PartitionedTableOptions& partitionedTableOptions);
+
+    PartitionedTable(const PartitionedTable&) = delete;
+    PartitionedTable& operator=(const PartitionedTable&) = delete;
+
+    // 파티션 목록 테이블 생성, 기존 파티션 목록 읽기 (CreateDatabase 이후 호출)
+    Errors Open();
+
+    // timeStamp가 속한 파티션 테이블 이름 (없으면 생성)
+    Errors AcquirePartition(_In_ uint64_t timeStamp, _Out_ std::string& partitionTableName);
+
+    /*
+        구조체 배열을 timeStampMember 기준으로 파티션에 나눠서 SqliteManager::BulkInsert
+        tableMapping의 테이블 이름 대신 파티션 테이블 이름을 사용
+        같은 파티션에 속한 연속된 행을 한 번에 INSERT하므로 시간순으로 정렬된 입력일수록 효율적
+    */
+    template <typename Row, typename TimeStamp, typename... Members>
+    Errors BulkInsert(
+        _In_ const TableMapping<Row, Members...>& tableMapping,
+        _In_ TimeStamp Row::* timeStampMember,
+        _In_reads_(rowCount) const Row* rowList,
+        _In_ uint32_t rowCount,
+        _In_opt_ const BulkInsertOptions& bulkInsertOptions = BulkInsertOptions(),
+        _Out_opt_ uint32_t* insertedRowCount = nullptr
+    );
+
+    // [beginTimeStamp, endTimeStamp]와 겹치는 파티션 (시간순)
+    void GetPartitionList(_In_ uint64_t beginTimeStamp, _In_ uint64_t endTimeStamp, _Out_ std::vector<PartitionInfo>& partitionInfoList);
+    void GetPartitionList(_Out_ std::vector<PartitionInfo>& partitionInfoList);
+
+    /*
+        겹치는 파티션만 UNION ALL로 묶은 SELECT 명령문 생성 (?1 = beginTimeStamp, ?2 = endTimeStamp, 둘 다 포함)
+        겹치는 파티션이 없으면 kNotFound
+        파티션이 추가, 삭제되면 명령문을 다시 만들어야 됨
+    */
+    Errors BuildRangeQuery(
+        _In_ const std::string& columnsName,
+        _In_ uint64_t beginTimeStamp,
+        _In_ uint64_t endTimeStamp,
+        _Out_ std::string& stmtString
+    );
+    // BuildRangeQuery 결과를 ExecStmt로 실행 (겹치는 파티션이 없으면 kNoResult)
+    Errors ExecRangeQuery(
+        _In_ const std::string& columnsName,
+        _In_ uint64_t beginTimeStamp,
+        _In_ uint64_t endTimeStamp,
+        _In_opt_ StepCallbackFunc* stmtStepCallback
+    );
+
+    // 구간 끝이 timeStamp 이하인(모든 행이 timeStamp보다 이전인) 파티션 DROP
+    Errors DropPartitionsBefore(_In_ uint64_t timeStamp, _Out_opt_ uint32_t* droppedPartitionCount = nullptr);
+
+private:
+    uint64_t GetPartitionBeginTimeStamp_(_In_ uint64_t timeStamp);
+    uint64_t GetPartitionTicks_();
+    Errors GetPartitionTableName_(_In_ uint64_t beginTimeStamp, _Out_ std::string& partitionTableName);
+    Errors CreatePartition_(_In_ uint64_t beginTimeStamp, _Out_ std::string& partitionTableName);
+    Errors DropPartition_(_In_ const PartitionInfo& partitionInfo);
+
+private:
+    SqliteManager& sqliteManager_;
+    PartitionedTableOptions partitionedTableOptions_;
+    std::string partitionListTableName_;
+
+    // beginTimeStamp -> 파티션
+    std::map<uint64_t, PartitionInfo> partitionInfoMap_;
+    bool opened_;
+};
+
+template <typename Row, typename TimeStamp, typename... Members>
+Errors PartitionedTable::BulkInsert(
+    _In_ const TableMapping<Row, Members...>& tableMapping,
+    _In_ TimeStamp Row::* timeStampMember,
+    _In_reads_(rowCount) const Row* rowList,
+    _In_ uint32_t rowCount,
+    _In_opt_ const BulkInsertOptions& bulkInsertOptions /*= BulkInsertOptions()*/,
+    _Out_opt_ uint32_t* insertedRowCount /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::string partitionTableName;
+    uint64_t partitionBeginTimeStamp = 0;
+    uint32_t runBeginRowIndex = 0;
+    uint32_t runEndRowIndex = 0;
+    uint32_t runInsertedRowCount = 0;
+    uint32_t totalInsertedRowCount = 0;
+
+    auto raii = RAIIRegister([&]
+        {
+            if (insertedRowCount != nullptr)
+            {
+                *insertedRowCount = totalInsertedRowCount;
+            }
+        });
+
+    if ((rowList == nullptr) && (rowCount != 0))
+    {
+        return retValue;
+    }
+
+    while (runBeginRowIndex < rowCount)
+    {
+        partitionBeginTimeStamp = GetPartitionBeginTimeStamp_(static_cast<uint64_t>(rowList[runBeginRowIndex].*timeStampMember));
+        for (runEndRowIndex = runBeginRowIndex + 1; runEndRowIndex < rowCount; runEndRowIndex++)
+        {
+            if (GetPartitionBeginTimeStamp_(static_cast<uint64_t>(rowList[runEndRowIndex].*timeStampMember)) != partitionBeginTimeStamp)
+            {
+                break;
+            }
+        }
+
+        retValue = AcquirePartition(partitionBeginTimeStamp, partitionTableName);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        runInsertedRowCount = 0;
+        retValue = sqliteManager_.BulkInsert(
+            tableMapping.WithTableName(partitionTableName),
+            rowList + runBeginRowIndex,
+            runEndRowIndex - runBeginRowIndex,
+            bulkInsertOptions,
+            &runInsertedRowCount
+        );
+        totalInsertedRowCount += runInsertedRowCount;
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        runBeginRowIndex = runEndRowIndex;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+} // namespace EzSqlite
\ No newline at end of file
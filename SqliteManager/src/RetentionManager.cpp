@@ -0,0 +1,480 @@
+#include "RetentionManager.h"
+
+double EzSqlite::RetentionStatistics::GetProgress() const
+{
+    double totalRowIdCount = 0;
+    double processedRowIdCount = 0;
+    bool completed = true;
+
+    for (const auto& tableProgressListEntry : tableProgressList)
+    {
+        if (tableProgressListEntry.completed == false)
+        {
+            completed = false;
+        }
+
+        // 삭제 대상이 없었던 테이블은 firstRowId > lastRowId
+        if (tableProgressListEntry.firstRowId > tableProgressListEntry.lastRowId)
+        {
+            continue;
+        }
+
+        totalRowIdCount += static_cast<double>(tableProgressListEntry.lastRowId - tableProgressListEntry.firstRowId) + 1;
+        if (tableProgressListEntry.completed == true)
+        {
+            processedRowIdCount += static_cast<double>(tableProgressListEntry.lastRowId - tableProgressListEntry.firstRowId) + 1;
+        }
+        else
+        {
+            processedRowIdCount += static_cast<double>(tableProgressListEntry.nextRowId - tableProgressListEntry.firstRowId);
+        }
+    }
+
+    if (totalRowIdCount == 0)
+    {
+        return ((completed == true) && (tableProgressList.empty() == false)) ? 1.0 : 0.0;
+    }
+
+    return processedRowIdCount / totalRowIdCount;
+}
+
+EzSqlite::RetentionManager::RetentionManager(
+    _In_ SqliteManager& sqliteManager,
+    _In_ const RetentionOptions& retentionOptions
+) : sqliteManager_(sqliteManager)
+{
+    retentionOptions_ = retentionOptions;
+    incrementalVacuumEnabled_ = false;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::EnableIncrementalVacuum()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    bool enabled = false;
+
+    if (sqliteManager_.IsInTransaction() == true)
+    {
+        return retValue;
+    }
+
+    retValue = IsIncrementalVacuumEnabled(enabled);
+    if ((retValue != Errors::kSuccess) || (enabled == true))
+    {
+        return retValue;
+    }
+
+    retValue = sqliteManager_.SetPragma(Pragma::kAutoVacuum, std::string("INCREMENTAL"));
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    // 테이블이 있는 Database는 VACUUM으로 다시 써야 auto_vacuum 변경이 적용됨
+    retValue = sqliteManager_.ExecStmt("VACUUM;");
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = IsIncrementalVacuumEnabled(enabled);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = (enabled == true) ? Errors::kSuccess : Errors::kUnsuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::IsIncrementalVacuumEnabled(
+    _Out_ bool& enabled
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    // 0: NONE, 1: FULL, 2: INCREMENTAL
+    int64_t autoVacuum = 0;
+
+    enabled = false;
+
+    retValue = sqliteManager_.GetPragma(Pragma::kAutoVacuum, autoVacuum);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    enabled = (autoVacuum == 2);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::Purge(
+    _In_ uint64_t currentTimeStamp,
+    _In_opt_ RetentionProgressCallbackFunc* progressCallback /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const uint32_t ruleCount = static_cast<uint32_t>(retentionOptions_.ruleList.size());
+
+    auto raii = RAIIRegister([&]
+        {
+            retentionStatistics_.elapsedMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - purgeBeginTime_).count());
+        });
+
+    purgeBeginTime_ = std::chrono::steady_clock::now();
+    retentionStatistics_ = RetentionStatistics();
+
+    if ((ruleCount == 0) || (retentionOptions_.chunkRowCount == 0) || (sqliteManager_.IsInTransaction() == true))
+    {
+        return retValue;
+    }
+
+    retValue = IsIncrementalVacuumEnabled(incrementalVacuumEnabled_);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    // 진행률을 계산할 수 있도록 모든 테이블의 삭제 범위를 먼저 구함
+    retentionStatistics_.tableProgressList.resize(ruleCount);
+
+    for (uint32_t ruleIndex = 0; ruleIndex < ruleCount; ruleIndex++)
+    {
+        const uint64_t maxAge = retentionOptions_.ruleList[ruleIndex].maxAge;
+
+        retentionStatistics_.tableProgressList[ruleIndex].cutoffTimeStamp = (currentTimeStamp > maxAge) ? (currentTimeStamp - maxAge) : 0;
+
+        retValue = FindRowIdRange_(ruleIndex, retentionStatistics_.tableProgressList[ruleIndex]);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    for (uint32_t ruleIndex = 0; ruleIndex < ruleCount; ruleIndex++)
+    {
+        while (retentionStatistics_.tableProgressList[ruleIndex].completed == false)
+        {
+            retValue = DeleteChunk_(ruleIndex, retentionStatistics_.tableProgressList[ruleIndex]);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+
+            retValue = InvokeProgressCallback_(progressCallback);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+
+            retValue = ScheduleVacuum_(progressCallback, false);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+
+            Pause_();
+        }
+    }
+
+    retValue = ScheduleVacuum_(progressCallback, true);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = GetFreePageCount_(retentionStatistics_.freePageCount);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::IncrementalVacuum(
+    _In_ uint32_t maxPageCount,
+    _Out_opt_ uint32_t* freedPageCount /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    uint64_t beforeFreePageCount = 0;
+    uint64_t afterFreePageCount = 0;
+
+    if (freedPageCount != nullptr)
+    {
+        *freedPageCount = 0;
+    }
+
+    retValue = GetFreePageCount_(beforeFreePageCount);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    // incremental_vacuum(0)은 freelist 전체를 제거하므로 실행하지 않음
+    if ((maxPageCount == 0) || (beforeFreePageCount == 0))
+    {
+        retentionStatistics_.freePageCount = beforeFreePageCount;
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    // PRAGMA 값은 Bind할 수 없으므로 SetPragma로 정수 리터럴을 만들어서 실행
+    retValue = sqliteManager_.SetPragma(Pragma::kIncrementalVacuum, maxPageCount);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = GetFreePageCount_(afterFreePageCount);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retentionStatistics_.vacuumStepCount++;
+    retentionStatistics_.freePageCount = afterFreePageCount;
+
+    if (beforeFreePageCount > afterFreePageCount)
+    {
+        retentionStatistics_.freedPageCount += beforeFreePageCount - afterFreePageCount;
+        if (freedPageCount != nullptr)
+        {
+            *freedPageCount = static_cast<uint32_t>(beforeFreePageCount - afterFreePageCount);
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::RetentionManager::GetStatistics(
+    _Out_ RetentionStatistics& retentionStatistics
+)
+{
+    retentionStatistics = retentionStatistics_;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::GetFreePageCount_(
+    _Out_ uint64_t& freePageCount
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int64_t freelistCount = 0;
+
+    freePageCount = 0;
+
+    retValue = sqliteManager_.GetPragma(Pragma::kFreelistCount, freelistCount);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    freePageCount = static_cast<uint64_t>(freelistCount);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::FindRowIdRange_(
+    _In_ uint32_t ruleIndex,
+    _Inout_ RetentionTableProgress& retentionTableProgress
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const RetentionRule& retentionRule = retentionOptions_.ruleList[ruleIndex];
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(1);
+
+    // 집계 함수라서 항상 한 행 (삭제 대상이 없으면 NULL)
+    StepCallbackFunc stepCallback = [&](const StmtInfo& stmtInfo)->CallbackErrors
+    {
+        ResultRow resultRow(stmtInfo.stmt);
+
+        if (resultRow.IsNull(0) == true)
+        {
+            return CallbackErrors::kStop;
+        }
+
+        retentionTableProgress.firstRowId = resultRow.Get<int64_t>(0);
+        retentionTableProgress.lastRowId = resultRow.Get<int64_t>(1);
+        return CallbackErrors::kContinue;
+    };
+
+    retentionTableProgress.tableName = retentionRule.tableName;
+    retentionTableProgress.firstRowId = 1;
+    retentionTableProgress.lastRowId = 0;
+
+    stmtBindParameterInfoList[0].data = &retentionTableProgress.cutoffTimeStamp;
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[0].dataByteSize = sizeof(retentionTableProgress.cutoffTimeStamp);
+    stmtBindParameterInfoList[0].options = StmtBindParameterOptions::kUnsigned;
+
+    // timeStamp 인덱스가 있으면 cutoff 이전 구간의 인덱스만 읽음
+    retValue = sqliteManager_.ExecStmt(
+        "SELECT min(rowid), max(rowid) FROM main." + retentionRule.tableName + " WHERE " + retentionRule.timeStampColumnName + " < ?;",
+        &stmtBindParameterInfoList,
+        &stepCallback
+    );
+    if ((retValue != Errors::kSuccess) && (retValue != Errors::kStopCallback))
+    {
+        return retValue;
+    }
+
+    retentionTableProgress.nextRowId = retentionTableProgress.firstRowId;
+    retentionTableProgress.completed = (retentionTableProgress.firstRowId > retentionTableProgress.lastRowId);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::DeleteChunk_(
+    _In_ uint32_t ruleIndex,
+    _Inout_ RetentionTableProgress& retentionTableProgress
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const RetentionRule& retentionRule = retentionOptions_.ruleList[ruleIndex];
+    int64_t chunkFirstRowId = retentionTableProgress.nextRowId;
+    int64_t chunkLastRowId = retentionTableProgress.lastRowId;
+    uint64_t deletedRowCount = 0;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(3);
+
+    if (static_cast<uint64_t>(retentionTableProgress.lastRowId - chunkFirstRowId) >= retentionOptions_.chunkRowCount)
+    {
+        chunkLastRowId = chunkFirstRowId + retentionOptions_.chunkRowCount - 1;
+    }
+
+    stmtBindParameterInfoList[0].data = &chunkFirstRowId;
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[0].dataByteSize = sizeof(chunkFirstRowId);
+    stmtBindParameterInfoList[0].options = StmtBindParameterOptions::kSigned;
+    stmtBindParameterInfoList[1].data = &chunkLastRowId;
+    stmtBindParameterInfoList[1].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[1].dataByteSize = sizeof(chunkLastRowId);
+    stmtBindParameterInfoList[1].options = StmtBindParameterOptions::kSigned;
+    stmtBindParameterInfoList[2].data = &retentionTableProgress.cutoffTimeStamp;
+    stmtBindParameterInfoList[2].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[2].dataByteSize = sizeof(retentionTableProgress.cutoffTimeStamp);
+    stmtBindParameterInfoList[2].options = StmtBindParameterOptions::kUnsigned;
+
+    // rowid 범위는 테이블 B-tree에서 바로 찾으므로 청크 하나의 비용은 chunkRowCount로 제한됨
+    retValue = sqliteManager_.ExecStmt(
+        "DELETE FROM main." + retentionRule.tableName + " WHERE rowid BETWEEN ? AND ? AND " + retentionRule.timeStampColumnName + " < ?;",
+        &stmtBindParameterInfoList
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    deletedRowCount = static_cast<uint64_t>(sqliteManager_.GetChanges());
+    retentionTableProgress.deletedRowCount += deletedRowCount;
+    retentionTableProgress.chunkCount++;
+    retentionStatistics_.deletedRowCount += deletedRowCount;
+    retentionStatistics_.chunkCount++;
+
+    if (chunkLastRowId == retentionTableProgress.lastRowId)
+    {
+        retentionTableProgress.nextRowId = chunkLastRowId;
+        retentionTableProgress.completed = true;
+    }
+    else
+    {
+        retentionTableProgress.nextRowId = chunkLastRowId + 1;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::ScheduleVacuum_(
+    _In_opt_ RetentionProgressCallbackFunc* progressCallback,
+    _In_ bool untilBelowThreshold
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const uint32_t vacuumPageBudget = retentionOptions_.vacuumPageBudget;
+    const uint64_t vacuumFreePageThreshold = (retentionOptions_.vacuumFreePageThreshold != 0) ? retentionOptions_.vacuumFreePageThreshold : vacuumPageBudget;
+    uint32_t freedPageCount = 0;
+
+    if ((vacuumPageBudget == 0) || (incrementalVacuumEnabled_ == false))
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    for (;;)
+    {
+        retValue = GetFreePageCount_(retentionStatistics_.freePageCount);
+        if ((retValue != Errors::kSuccess) || (retentionStatistics_.freePageCount < vacuumFreePageThreshold))
+        {
+            return retValue;
+        }
+
+        retValue = IncrementalVacuum(vacuumPageBudget, &freedPageCount);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        retValue = InvokeProgressCallback_(progressCallback);
+        if ((retValue != Errors::kSuccess) || (untilBelowThreshold == false) || (freedPageCount == 0))
+        {
+            return retValue;
+        }
+
+        Pause_();
+    }
+}
+
+EzSqlite::Errors EzSqlite::RetentionManager::InvokeProgressCallback_(
+    _In_opt_ RetentionProgressCallbackFunc* progressCallback
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    CallbackErrors callbackStatus = CallbackErrors::kContinue;
+
+    if ((progressCallback == nullptr) || (*progressCallback == nullptr))
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    retentionStatistics_.elapsedMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - purgeBeginTime_).count());
+
+    callbackStatus = (*progressCallback)(retentionStatistics_);
+    if (callbackStatus == CallbackErrors::kStop)
+    {
+        retValue = Errors::kStopCallback;
+        return retValue;
+    }
+    else if (callbackStatus == CallbackErrors::kFail)
+    {
+        retValue = Errors::kFailCallback;
+        return retValue;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::RetentionManager::Pause_()
+{
+    if (retentionOptions_.yieldMilliseconds != 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(retentionOptions_.yieldMilliseconds));
+    }
+}
\ No newline at end of file
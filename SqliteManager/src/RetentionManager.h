@@ -0,0 +1,148 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+#include <thread>
+
+namespace EzSqlite
+{
+
+const uint32_t kDefaultRetentionChunkRowCount = 4096;
+const uint32_t kDefaultRetentionYieldMilliseconds = 5;
+const uint32_t kDefaultRetentionVacuumPageBudget = 1024;
+
+struct RetentionRule
+{
+    RetentionRule()
+    {
+        timeStampColumnName = "C_TimeStamp";
+        maxAge = 0;
+    };
+
+    std::string tableName;              // rowid 테이블이어야 됨 (WITHOUT ROWID 테이블은 지원하지 않음)
+    std::string timeStampColumnName;    // 인덱스가 있어야 삭제 범위를 빠르게 찾음
+    uint64_t maxAge;                    // timeStampColumnName과 같은 단위 (C_TimeStamp는 FILETIME, 100ns)
+};
+
+struct RetentionOptions
+{
+    RetentionOptions()
+    {
+        chunkRowCount = kDefaultRetentionChunkRowCount;
+        yieldMilliseconds = kDefaultRetentionYieldMilliseconds;
+        vacuumPageBudget = kDefaultRetentionVacuumPageBudget;
+        vacuumFreePageThreshold = 0;
+    };
+
+    std::vector<RetentionRule> ruleList;
+    uint32_t chunkRowCount;             // DELETE 하나가 검사하는 rowid 범위 크기 (청크마다 별도 트랜잭션)
+    uint32_t yieldMilliseconds;         // 청크, incremental_vacuum 사이에 쉬는 시간 (0이면 바로 다음 청크를 잠가서 Busy 대기 중인 연결이 계속 밀릴 수 있음)
+    uint32_t vacuumPageBudget;          // incremental_vacuum 한 번에 파일에서 제거할 최대 페이지 수 (0이면 사용 안 함)
+    uint32_t vacuumFreePageThreshold;   // freelist 페이지가 이 값 이상이면 incremental_vacuum 실행 (0이면 vacuumPageBudget)
+};
+
+struct RetentionTableProgress
+{
+    RetentionTableProgress()
+    {
+        cutoffTimeStamp = 0;
+        firstRowId = 0;
+        lastRowId = 0;
+        nextRowId = 0;
+        deletedRowCount = 0;
+        chunkCount = 0;
+        completed = false;
+    };
+
+    std::string tableName;
+    uint64_t cutoffTimeStamp;           // 이 값보다 작은 행을 삭제
+    int64_t firstRowId;                 // Purge 시작 시점의 삭제 대상 rowid 범위
+    int64_t lastRowId;
+    int64_t nextRowId;                  // 다음 청크의 시작 rowid
+    uint64_t deletedRowCount;
+    uint64_t chunkCount;
+    bool completed;
+};
+
+struct RetentionStatistics
+{
+    RetentionStatistics()
+    {
+        deletedRowCount = 0;
+        chunkCount = 0;
+        vacuumStepCount = 0;
+        freedPageCount = 0;
+        freePageCount = 0;
+        elapsedMicroseconds = 0;
+    };
+
+    // 처리한 rowid 범위 비율 (0.0 ~ 1.0)
+    double GetProgress() const;
+
+    std::vector<RetentionTableProgress> tableProgressList;     // ruleList 순서
+    uint64_t deletedRowCount;
+    uint64_t chunkCount;
+    uint64_t vacuumStepCount;
+    uint64_t freedPageCount;            // incremental_vacuum으로 파일에서 제거된 페이지 수
+    uint64_t freePageCount;             // 마지막으로 확인한 freelist_count
+    uint64_t elapsedMicroseconds;
+};
+
+// 청크, incremental_vacuum이 끝날 때마다 호출 (kStop이면 Purge가 kStopCallback, kFail이면 kFailCallback 리턴)
+typedef std::function<CallbackErrors(const RetentionStatistics& retentionStatistics)> RetentionProgressCallbackFunc;
+
+/*
+    테이블마다 보존 기간이 지난 행을 작은 청크로 나눠서 삭제하고 incremental_vacuum으로 파일 크기를 줄임
+
+    삭제 대상의 rowid 범위를 먼저 구한 후 chunkRowCount 크기의 rowid 범위마다
+    DELETE ... WHERE rowid BETWEEN ? AND ? AND timeStamp < cutoff를 autocommit으로 실행
+    청크 사이에서 쓰기 잠금이 풀리므로 같은 Database에 INSERT하는 연결이 오래 대기하지 않음
+
+    VACUUM은 Database 전체를 다시 쓰고 그동안 다른 연결의 접근을 막으므로 사용하지 않음
+    삭제로 생긴 freelist 페이지가 vacuumFreePageThreshold 이상이면 청크 사이에서 incremental_vacuum(vacuumPageBudget)을 한 번 실행하고,
+    모든 청크를 삭제한 후에는 freelist 페이지가 vacuumFreePageThreshold보다 적어질 때까지 반복 (남은 페이지는 INSERT에서 재사용)
+    incremental_vacuum은 auto_vacuum=INCREMENTAL인 Database에서만 동작 (OpenOptions::autoVacuumMode로 생성 시 지정)
+    기존 Database는 EnableIncrementalVacuum으로 한 번 변환해야 됨 (변환할 때만 VACUUM 실행)
+
+    Purge가 중간에 중단되어도 이미 삭제된 청크는 COMMIT된 상태이며, 다시 호출하면 남은 범위부터 진행
+    SqliteManager와 마찬가지로 스레드에 안전하지 않음
+*/
+class RetentionManager
+{
+public:
+    explicit RetentionManager(_In_ SqliteManager& sqliteManager, _In_ const RetentionOptions& retentionOptions);
+
+    RetentionManager(const RetentionManager&) = delete;
+    RetentionManager& operator=(const RetentionManager&) = delete;
+
+    // auto_vacuum이 INCREMENTAL이 아니면 INCREMENTAL로 바꾸고 VACUUM (Database 전체를 다시 씀, 트랜잭션 밖에서 호출해야 됨)
+    Errors EnableIncrementalVacuum();
+    Errors IsIncrementalVacuumEnabled(_Out_ bool& enabled);
+
+    // currentTimeStamp - maxAge보다 이전인 행 삭제 (트랜잭션 밖에서 호출해야 됨)
+    Errors Purge(_In_ uint64_t currentTimeStamp, _In_opt_ RetentionProgressCallbackFunc* progressCallback = nullptr);
+
+    // freelist 페이지를 최대 maxPageCount개 파일에서 제거 (auto_vacuum이 INCREMENTAL이 아니면 아무것도 하지 않음)
+    Errors IncrementalVacuum(_In_ uint32_t maxPageCount, _Out_opt_ uint32_t* freedPageCount = nullptr);
+
+    // 마지막 Purge의 진행 상태 (IncrementalVacuum 결과 포함)
+    void GetStatistics(_Out_ RetentionStatistics& retentionStatistics);
+
+private:
+    Errors GetFreePageCount_(_Out_ uint64_t& freePageCount);
+    Errors FindRowIdRange_(_In_ uint32_t ruleIndex, _Inout_ RetentionTableProgress& retentionTableProgress);
+    Errors DeleteChunk_(_In_ uint32_t ruleIndex, _Inout_ RetentionTableProgress& retentionTableProgress);
+    Errors ScheduleVacuum_(_In_opt_ RetentionProgressCallbackFunc* progressCallback, _In_ bool untilBelowThreshold);
+    Errors InvokeProgressCallback_(_In_opt_ RetentionProgressCallbackFunc* progressCallback);
+    void Pause_();
+
+private:
+    SqliteManager& sqliteManager_;
+    RetentionOptions retentionOptions_;
+    RetentionStatistics retentionStatistics_;
+
+    bool incrementalVacuumEnabled_;     // Purge 시작 시점의 auto_vacuum
+    std::chrono::steady_clock::time_point purgeBeginTime_;
+};
+
+} // namespace EzSqlite
\ No newline at end of file
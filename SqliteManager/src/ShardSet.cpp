@@ -0,0 +1,473 @@
+#include "ShardSet.h"
+
+EzSqlite::ShardSet::ShardSet(
+    _In_ SqliteManager& sqliteManager,
+    _In_ const ShardSetOptions& shardSetOptions
+) : sqliteManager_(sqliteManager)
+{
+    shardSetOptions_ = shardSetOptions;
+    nextShardNumber_ = 0;
+    useSequence_ = 0;
+}
+
+EzSqlite::ShardSet::~ShardSet()
+{
+    this->DetachAll();
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::AddShard(
+    _In_ const std::wstring& shardPath,
+    _In_ uint64_t minTimeStamp,
+    _In_ uint64_t maxTimeStamp
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    Shard shard;
+
+    for (const auto& shardListEntry : shardList_)
+    {
+        if (shardListEntry.shardInfo.shardPath == shardPath)
+        {
+            return retValue;
+        }
+    }
+
+    shard.shardInfo.shardPath = shardPath;
+    shard.shardInfo.minTimeStamp = minTimeStamp;
+    shard.shardInfo.maxTimeStamp = maxTimeStamp;
+    shard.schemaName = "SHARD_" + std::to_string(nextShardNumber_++);
+    shardList_.push_back(std::move(shard));
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::AddShard(
+    _In_ const std::wstring& shardPath
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    SqliteManager shardSqliteManager;
+    uint64_t minTimeStamp = static_cast<uint64_t>(-1);
+    uint64_t maxTimeStamp = 0;
+
+    // C_TimeStamp 인덱스가 있으면 min, max는 인덱스 양 끝만 읽음
+    StepCallbackFunc stepCallback = [&](const StmtInfo& stmtInfo)->CallbackErrors
+    {
+        ResultRow resultRow(stmtInfo.stmt);
+
+        if (resultRow.IsNull(0) == false)
+        {
+            minTimeStamp = (std::min)(minTimeStamp, resultRow.Get<uint64_t>(0));
+            maxTimeStamp = (std::max)(maxTimeStamp, resultRow.Get<uint64_t>(1));
+        }
+
+        return CallbackErrors::kContinue;
+    };
+
+    retValue = shardSqliteManager.CreateDatabase(
+        shardPath,
+        DesiredAccess::kReadOnly,
+        CreationDisposition::kOpenExisting,
+        nullptr,
+        nullptr,
+        std::vector<std::string>()
+    );
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (const auto& tableName : shardSetOptions_.tableNameList)
+    {
+        retValue = shardSqliteManager.ExecStmt(
+            "SELECT min(" + shardSetOptions_.timeStampColumnName + "), max(" + shardSetOptions_.timeStampColumnName + ") FROM " + tableName + ";",
+            nullptr,
+            &stepCallback
+        );
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    shardSqliteManager.CloseDatabase();
+
+    return AddShard(shardPath, minTimeStamp, maxTimeStamp);
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::RemoveShard(
+    _In_ const std::wstring& shardPath
+)
+{
+    Errors retValue = Errors::kNotFound;
+
+    for (auto shardEntry = shardList_.begin(); shardEntry != shardList_.end(); ++shardEntry)
+    {
+        if (shardEntry->shardInfo.shardPath != shardPath)
+        {
+            continue;
+        }
+
+        // 뷰가 DETACH할 샤드를 참조하지 않도록 먼저 제거 (다음 SelectTimeRange에서 다시 생성)
+        if (shardEntry->attached == true)
+        {
+            retValue = DropView_();
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+
+            retValue = DetachShard_(*shardEntry);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+        }
+
+        shardList_.erase(shardEntry);
+
+        retValue = Errors::kSuccess;
+        break;
+    }
+
+    return retValue;
+}
+
+void EzSqlite::ShardSet::GetShardList(
+    _Out_ std::vector<ShardInfo>& shardInfoList
+)
+{
+    shardInfoList.clear();
+
+    for (const auto& shardListEntry : shardList_)
+    {
+        shardInfoList.push_back(shardListEntry.shardInfo);
+    }
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::SelectTimeRange(
+    _In_ uint64_t beginTimeStamp,
+    _In_ uint64_t endTimeStamp,
+    _Out_opt_ std::vector<ShardInfo>* selectedShardInfoList /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::vector<Shard*> selectedShardList;
+    uint32_t maxAttachedShardCount = GetMaxAttachedShardCount_();
+    uint32_t attachedShardCount = 0;
+    Shard* evictShard = nullptr;
+
+    if (selectedShardInfoList != nullptr)
+    {
+        selectedShardInfoList->clear();
+    }
+
+    if (sqliteManager_.IsInTransaction() == true)
+    {
+        return retValue;
+    }
+
+    // ATTACH하기 전에 min/max로 제외
+    for (auto& shardListEntry : shardList_)
+    {
+        if ((shardListEntry.shardInfo.minTimeStamp <= shardListEntry.shardInfo.maxTimeStamp) &&
+            (shardListEntry.shardInfo.minTimeStamp <= endTimeStamp) &&
+            (beginTimeStamp <= shardListEntry.shardInfo.maxTimeStamp))
+        {
+            selectedShardList.push_back(&shardListEntry);
+        }
+        else
+        {
+            shardSetStatistics_.prunedShardCount++;
+        }
+
+        if (shardListEntry.attached == true)
+        {
+            attachedShardCount++;
+        }
+    }
+
+    if (selectedShardList.size() > maxAttachedShardCount)
+    {
+        return retValue;
+    }
+
+    // 뷰가 참조하는 샤드는 DETACH할 수 없으므로 먼저 제거
+    retValue = DropView_();
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    if (selectedShardList.size() == 0)
+    {
+        retValue = Errors::kNotFound;
+        return retValue;
+    }
+
+    // 선택된 샤드를 최근 사용으로 표시한 뒤 부족한 자리만큼 LRU 순서로 DETACH
+    for (auto& selectedShard : selectedShardList)
+    {
+        selectedShard->lastUsedSequence = ++useSequence_;
+        if (selectedShard->attached == true)
+        {
+            shardSetStatistics_.reuseCount++;
+        }
+    }
+
+    for (const auto& selectedShard : selectedShardList)
+    {
+        if (selectedShard->attached == true)
+        {
+            continue;
+        }
+
+        while (attachedShardCount >= maxAttachedShardCount)
+        {
+            evictShard = nullptr;
+            for (auto& shardListEntry : shardList_)
+            {
+                if ((shardListEntry.attached == true) &&
+                    ((evictShard == nullptr) || (shardListEntry.lastUsedSequence < evictShard->lastUsedSequence)))
+                {
+                    evictShard = &shardListEntry;
+                }
+            }
+
+            retValue = DetachShard_(*evictShard);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+            attachedShardCount--;
+        }
+
+        retValue = AttachShard_(*selectedShard);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+        attachedShardCount++;
+    }
+
+    retValue = CreateView_(selectedShardList);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    if (selectedShardInfoList != nullptr)
+    {
+        for (const auto& selectedShard : selectedShardList)
+        {
+            selectedShardInfoList->push_back(selectedShard->shardInfo);
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::ExecRangeQuery(
+    _In_ const std::string& tableName,
+    _In_ const std::string& columnsName,
+    _In_ uint64_t beginTimeStamp,
+    _In_ uint64_t endTimeStamp,
+    _In_opt_ StepCallbackFunc* stmtStepCallback
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int64_t timeStampList[] = { static_cast<int64_t>(beginTimeStamp), static_cast<int64_t>(endTimeStamp) };
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(_countof(timeStampList));
+
+    retValue = SelectTimeRange(beginTimeStamp, endTimeStamp);
+    if (retValue == Errors::kNotFound)
+    {
+        retValue = Errors::kNoResult;
+        return retValue;
+    }
+    else if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (uint32_t timeStampIndex = 0; timeStampIndex < _countof(timeStampList); timeStampIndex++)
+    {
+        stmtBindParameterInfoList[timeStampIndex].data = &timeStampList[timeStampIndex];
+        stmtBindParameterInfoList[timeStampIndex].dataType = StmtDataType::kInteger;
+        stmtBindParameterInfoList[timeStampIndex].dataByteSize = sizeof(int64_t);
+        stmtBindParameterInfoList[timeStampIndex].options = StmtBindParameterOptions::kSigned;
+    }
+
+    return sqliteManager_.ExecStmt(
+        "SELECT " + columnsName + " FROM temp." + tableName + shardSetOptions_.viewSuffix +
+        " WHERE " + shardSetOptions_.timeStampColumnName + " >= ? AND " + shardSetOptions_.timeStampColumnName + " <= ?;",
+        &stmtBindParameterInfoList,
+        stmtStepCallback
+    );
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::DetachAll()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    retValue = DropView_();
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    for (auto& shardListEntry : shardList_)
+    {
+        if (shardListEntry.attached == true)
+        {
+            retValue = DetachShard_(shardListEntry);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::ShardSet::GetStatistics(
+    _Out_ ShardSetStatistics& shardSetStatistics
+)
+{
+    shardSetStatistics = shardSetStatistics_;
+    shardSetStatistics.shardCount = static_cast<uint32_t>(shardList_.size());
+    shardSetStatistics.attachedShardCount = 0;
+
+    for (const auto& shardListEntry : shardList_)
+    {
+        if (shardListEntry.attached == true)
+        {
+            shardSetStatistics.attachedShardCount++;
+        }
+    }
+}
+
+uint32_t EzSqlite::ShardSet::GetMaxAttachedShardCount_()
+{
+    int attachedLimit = 0;
+
+    if (shardSetOptions_.maxAttachedShardCount != 0)
+    {
+        return shardSetOptions_.maxAttachedShardCount;
+    }
+
+    attachedLimit = sqliteManager_.GetLimit(SQLITE_LIMIT_ATTACHED);
+    return (attachedLimit < 0) ? 0 : static_cast<uint32_t>(attachedLimit);
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::AttachShard_(
+    _Inout_ Shard& shard
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
+    std::string shardPathUtf8;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(1);
+
+    try
+    {
+        shardPathUtf8 = convert.to_bytes(shard.shardInfo.shardPath);
+    }
+    catch (...)
+    {
+        return retValue;
+    }
+
+    stmtBindParameterInfoList[0].data = shardPathUtf8.c_str();
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kText;
+    stmtBindParameterInfoList[0].dataByteSize = static_cast<uint32_t>(shardPathUtf8.length());
+
+    retValue = sqliteManager_.ExecStmt("ATTACH DATABASE ? AS " + shard.schemaName + ";", &stmtBindParameterInfoList);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    shard.attached = true;
+    shardSetStatistics_.attachCount++;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::DetachShard_(
+    _Inout_ Shard& shard
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    retValue = sqliteManager_.ExecStmt("DETACH DATABASE " + shard.schemaName + ";");
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    shard.attached = false;
+    shardSetStatistics_.detachCount++;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::DropView_()
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    for (const auto& tableName : shardSetOptions_.tableNameList)
+    {
+        retValue = sqliteManager_.ExecStmt("DROP VIEW IF EXISTS temp." + tableName + shardSetOptions_.viewSuffix + ";");
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::ShardSet::CreateView_(
+    _In_ const std::vector<Shard*>& selectedShardList
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::string createViewStmtString;
+
+    for (const auto& tableName : shardSetOptions_.tableNameList)
+    {
+        createViewStmtString = "CREATE TEMP VIEW " + tableName + shardSetOptions_.viewSuffix + " AS ";
+        for (uint32_t selectedShardIndex = 0; selectedShardIndex < selectedShardList.size(); selectedShardIndex++)
+        {
+            if (selectedShardIndex != 0)
+            {
+                createViewStmtString += " UNION ALL ";
+            }
+            createViewStmtString += "SELECT * FROM " + selectedShardList[selectedShardIndex]->schemaName + "." + tableName;
+        }
+        createViewStmtString += ";";
+
+        retValue = sqliteManager_.ExecStmt(createViewStmtString);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
\ No newline at end of file
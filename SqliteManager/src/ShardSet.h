@@ -0,0 +1,140 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+namespace EzSqlite
+{
+
+struct ShardSetOptions
+{
+    ShardSetOptions()
+    {
+        timeStampColumnName = "C_TimeStamp";
+        viewSuffix = "_SHARD";
+        maxAttachedShardCount = 0;
+    };
+
+    std::vector<std::string> tableNameList;     // UNION ALL 뷰를 만들 테이블 (모든 샤드에 같은 스키마로 존재해야 됨)
+    std::string timeStampColumnName;
+    std::string viewSuffix;                     // 뷰 이름은 temp.<tableName><viewSuffix>
+    uint32_t maxAttachedShardCount;             // 동시에 ATTACH할 최대 샤드 수 (0이면 SQLITE_LIMIT_ATTACHED)
+};
+
+struct ShardInfo
+{
+    ShardInfo()
+    {
+        minTimeStamp = 0;
+        maxTimeStamp = 0;
+    };
+
+    std::wstring shardPath;
+    uint64_t minTimeStamp;      // minTimeStamp > maxTimeStamp이면 빈 샤드 (조회 대상에서 제외)
+    uint64_t maxTimeStamp;
+};
+
+struct ShardSetStatistics
+{
+    ShardSetStatistics()
+    {
+        shardCount = 0;
+        attachedShardCount = 0;
+        attachCount = 0;
+        detachCount = 0;
+        reuseCount = 0;
+        prunedShardCount = 0;
+    };
+
+    uint32_t shardCount;
+    uint32_t attachedShardCount;
+    uint64_t attachCount;
+    uint64_t detachCount;       // LRU로 밀려나서 DETACH된 횟수 포함
+    uint64_t reuseCount;        // 이미 ATTACH되어 있어서 재사용한 횟수
+    uint64_t prunedShardCount;  // min/max 범위가 겹치지 않아서 ATTACH하지 않은 샤드 수 (누적)
+};
+
+/*
+    일별 DB 파일 등 같은 스키마의 샤드 파일들을 하나의 연결에 ATTACH해서 조회
+
+    샤드마다 C_TimeStamp min/max를 등록해 두고, SelectTimeRange는 범위가 겹치는 샤드만 ATTACH
+    ATTACH 가능한 수(SQLITE_LIMIT_ATTACHED, 기본 10)를 넘으면 가장 오래 사용되지 않은 샤드부터 DETACH (LRU)
+    선택된 샤드를 테이블마다 temp.<tableName><viewSuffix> UNION ALL 뷰로 묶으므로 조회는 뷰에 WHERE를 붙여서 실행
+    (SQLite가 WHERE 조건을 UNION ALL의 각 SELECT로 전달하므로 샤드별 인덱스 사용 가능)
+
+    ATTACH, DETACH는 트랜잭션 안에서 실행할 수 없으므로 SelectTimeRange는 트랜잭션 밖에서 호출해야 됨
+    같은 연결에서 ShardSet 외에 ATTACH한 DB가 있으면 그만큼 maxAttachedShardCount를 줄여야 됨
+    SqliteManager와 마찬가지로 스레드에 안전하지 않음
+*/
+class ShardSet
+{
+public:
+    explicit ShardSet(_In_ SqliteManager& sqliteManager, _In_ const ShardSetOptions& shardSetOptions);
+    ~ShardSet();
+
+    ShardSet(const ShardSet&) = delete;
+    ShardSet& operator=(const ShardSet&) = delete;
+
+    // 이미 알고 있는 min/max로 등록 (파일을 열지 않음)
+    Errors AddShard(_In_ const std::wstring& shardPath, _In_ uint64_t minTimeStamp, _In_ uint64_t maxTimeStamp);
+    // 샤드 파일을 별도 연결로 열어서 tableNameList 전체의 min/max를 읽고 등록
+    Errors AddShard(_In_ const std::wstring& shardPath);
+    Errors RemoveShard(_In_ const std::wstring& shardPath);
+    void GetShardList(_Out_ std::vector<ShardInfo>& shardInfoList);
+
+    /*
+        [beginTimeStamp, endTimeStamp]와 겹치는 샤드만 ATTACH하고 뷰를 다시 생성
+        겹치는 샤드가 없으면 뷰를 제거하고 kNotFound
+        겹치는 샤드 수가 maxAttachedShardCount보다 많으면 kUnsuccess (범위를 나눠서 조회해야 됨)
+    */
+    Errors SelectTimeRange(
+        _In_ uint64_t beginTimeStamp,
+        _In_ uint64_t endTimeStamp,
+        _Out_opt_ std::vector<ShardInfo>* selectedShardInfoList = nullptr
+    );
+
+    // SelectTimeRange 후 뷰에서 [beginTimeStamp, endTimeStamp] 범위 조회 (겹치는 샤드가 없으면 kNoResult)
+    Errors ExecRangeQuery(
+        _In_ const std::string& tableName,
+        _In_ const std::string& columnsName,
+        _In_ uint64_t beginTimeStamp,
+        _In_ uint64_t endTimeStamp,
+        _In_opt_ StepCallbackFunc* stmtStepCallback
+    );
+
+    // 뷰 제거, 모든 샤드 DETACH
+    Errors DetachAll();
+
+    void GetStatistics(_Out_ ShardSetStatistics& shardSetStatistics);
+
+private:
+    struct Shard
+    {
+        Shard()
+        {
+            attached = false;
+            lastUsedSequence = 0;
+        };
+
+        ShardInfo shardInfo;
+        std::string schemaName;         // SHARD_<n> (ATTACH ... AS schemaName)
+        bool attached;
+        uint64_t lastUsedSequence;      // LRU 순서 (클수록 최근)
+    };
+
+    uint32_t GetMaxAttachedShardCount_();
+    Errors AttachShard_(_Inout_ Shard& shard);
+    Errors DetachShard_(_Inout_ Shard& shard);
+    Errors DropView_();
+    Errors CreateView_(_In_ const std::vector<Shard*>& selectedShardList);
+
+private:
+    SqliteManager& sqliteManager_;
+    ShardSetOptions shardSetOptions_;
+    ShardSetStatistics shardSetStatistics_;
+
+    std::list<Shard> shardList_;        // 등록 순서 (RemoveShard로 중간 항목이 제거되므로 list 사용)
+    uint32_t nextShardNumber_;
+    uint64_t useSequence_;
+};
+
+} // namespace EzSqlite
\ No newline at end of file
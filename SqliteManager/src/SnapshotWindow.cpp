@@ -0,0 +1,329 @@
+#include "SnapshotWindow.h"
+
+EzSqlite::SnapshotWindow::SnapshotWindow(
+    _In_ const SnapshotWindowOptions& snapshotWindowOptions
+)
+{
+    snapshotWindowOptions_ = snapshotWindowOptions;
+}
+
+EzSqlite::Errors EzSqlite::SnapshotWindow::Copy(
+    _In_ SqliteManager& sqliteManager,
+    _In_ uint64_t beginTimeStamp,
+    _In_ uint64_t endTimeStamp,
+    _Out_opt_ SnapshotWindowStatistics* snapshotWindowStatistics /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const uint32_t tableCount = static_cast<uint32_t>(snapshotWindowOptions_.tableNameList.size());
+    SnapshotWindowStatistics copyStatistics;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(2);
+    std::chrono::steady_clock::time_point copyBeginTime;
+    std::chrono::steady_clock::time_point tableBeginTime;
+    bool transactionStarted = false;
+
+    auto raii = RAIIRegister([&]
+        {
+            if ((retValue != Errors::kSuccess) && (transactionStarted == true))
+            {
+                sqliteManager.RollbackTransaction();
+            }
+
+            if (snapshotWindowStatistics != nullptr)
+            {
+                *snapshotWindowStatistics = copyStatistics;
+            }
+        });
+
+    if ((tableCount == 0) || (beginTimeStamp > endTimeStamp) || (sqliteManager.IsInTransaction() == true))
+    {
+        return retValue;
+    }
+
+    retValue = AttachTarget_(sqliteManager);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    stmtBindParameterInfoList[0].data = &beginTimeStamp;
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[0].dataByteSize = sizeof(beginTimeStamp);
+    stmtBindParameterInfoList[0].options = StmtBindParameterOptions::kUnsigned;
+    stmtBindParameterInfoList[1].data = &endTimeStamp;
+    stmtBindParameterInfoList[1].dataType = StmtDataType::kInteger;
+    stmtBindParameterInfoList[1].dataByteSize = sizeof(endTimeStamp);
+    stmtBindParameterInfoList[1].options = StmtBindParameterOptions::kUnsigned;
+
+    copyBeginTime = std::chrono::steady_clock::now();
+
+    // kMain만 원본 Database에 쓰므로 처음부터 쓰기 잠금을 잡음 (나머지는 원본에 대해 읽기 잠금만 사용)
+    retValue = sqliteManager.BeginTransaction(snapshotWindowOptions_.snapshotTarget == SnapshotTarget::kMain);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+    transactionStarted = true;
+
+    copyStatistics.tableStatisticsList.resize(tableCount);
+
+    for (uint32_t tableIndex = 0; tableIndex < tableCount; tableIndex++)
+    {
+        SnapshotTableStatistics& snapshotTableStatistics = copyStatistics.tableStatisticsList[tableIndex];
+
+        snapshotTableStatistics.tableName = snapshotWindowOptions_.tableNameList[tableIndex];
+        tableBeginTime = std::chrono::steady_clock::now();
+
+        retValue = CreateTargetTable_(sqliteManager, tableIndex);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        retValue = sqliteManager.ExecStmt("INSERT INTO " + GetTargetTableName(tableIndex) + " " + GetSelectStmtString_(tableIndex), &stmtBindParameterInfoList);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+
+        snapshotTableStatistics.copiedRowCount = static_cast<uint64_t>(sqliteManager.GetChanges());
+        copyStatistics.totalCopiedRowCount += snapshotTableStatistics.copiedRowCount;
+
+        SetTableStatistics_(
+            snapshotTableStatistics,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tableBeginTime).count())
+        );
+    }
+
+    retValue = sqliteManager.CommitTransaction();
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+    transactionStarted = false;
+
+    copyStatistics.elapsedMicroseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - copyBeginTime).count());
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::SnapshotWindow::DetachTarget(
+    _In_ SqliteManager& sqliteManager
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    bool attached = false;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(1);
+
+    StepCallbackFunc stepCallback = [&](const StmtInfo&)->CallbackErrors
+    {
+        attached = true;
+        return CallbackErrors::kContinue;
+    };
+
+    if (snapshotWindowOptions_.snapshotTarget != SnapshotTarget::kAttached)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    stmtBindParameterInfoList[0].data = snapshotWindowOptions_.targetSchemaName.c_str();
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kText;
+    stmtBindParameterInfoList[0].dataByteSize = static_cast<uint32_t>(snapshotWindowOptions_.targetSchemaName.length());
+
+    // ATTACH되어 있지 않으면 kNoResult
+    retValue = sqliteManager.ExecStmt("SELECT 1 FROM pragma_database_list WHERE name = ?;", &stmtBindParameterInfoList, &stepCallback);
+    if ((retValue != Errors::kSuccess) && (retValue != Errors::kNoResult))
+    {
+        return retValue;
+    }
+
+    if (attached == false)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    retValue = sqliteManager.ExecStmt("DETACH DATABASE " + snapshotWindowOptions_.targetSchemaName + ";");
+    return retValue;
+}
+
+std::string EzSqlite::SnapshotWindow::GetTargetTableName(
+    _In_ uint32_t tableIndex
+) const
+{
+    return GetTargetSchemaName_() + "." + snapshotWindowOptions_.tableNameList[tableIndex] + snapshotWindowOptions_.targetTableSuffix;
+}
+
+std::string EzSqlite::SnapshotWindow::GetTargetSchemaName_() const
+{
+    switch (snapshotWindowOptions_.snapshotTarget)
+    {
+    case SnapshotTarget::kTemp:
+        return "temp";
+
+    case SnapshotTarget::kAttached:
+        return snapshotWindowOptions_.targetSchemaName;
+
+    default:
+        return "main";
+    }
+}
+
+std::string EzSqlite::SnapshotWindow::GetSelectStmtString_(
+    _In_ uint32_t tableIndex
+) const
+{
+    // kTemp 대상 테이블과 이름이 겹쳐도 원본을 읽도록 main 스키마 지정
+    return "SELECT * FROM main." + snapshotWindowOptions_.tableNameList[tableIndex] +
+        " WHERE " + snapshotWindowOptions_.timeStampColumnName + " >= ? AND " + snapshotWindowOptions_.timeStampColumnName + " <= ?;";
+}
+
+EzSqlite::Errors EzSqlite::SnapshotWindow::AttachTarget_(
+    _In_ SqliteManager& sqliteManager
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    bool attached = false;
+    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
+    std::string targetDatabasePathUtf8;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(1);
+
+    StepCallbackFunc stepCallback = [&](const StmtInfo&)->CallbackErrors
+    {
+        attached = true;
+        return CallbackErrors::kContinue;
+    };
+
+    if (snapshotWindowOptions_.snapshotTarget != SnapshotTarget::kAttached)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    // 이전 Copy에서 ATTACH한 Database를 그대로 사용
+    stmtBindParameterInfoList[0].data = snapshotWindowOptions_.targetSchemaName.c_str();
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kText;
+    stmtBindParameterInfoList[0].dataByteSize = static_cast<uint32_t>(snapshotWindowOptions_.targetSchemaName.length());
+
+    retValue = sqliteManager.ExecStmt("SELECT 1 FROM pragma_database_list WHERE name = ?;", &stmtBindParameterInfoList, &stepCallback);
+    if ((retValue != Errors::kSuccess) && (retValue != Errors::kNoResult))
+    {
+        return retValue;
+    }
+
+    if (attached == true)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    retValue = Errors::kUnsuccess;
+
+    try
+    {
+        targetDatabasePathUtf8 = convert.to_bytes(snapshotWindowOptions_.targetDatabasePath);
+    }
+    catch (...)
+    {
+        return retValue;
+    }
+
+    stmtBindParameterInfoList[0].data = targetDatabasePathUtf8.c_str();
+    stmtBindParameterInfoList[0].dataByteSize = static_cast<uint32_t>(targetDatabasePathUtf8.length());
+
+    retValue = sqliteManager.ExecStmt("ATTACH DATABASE ? AS " + snapshotWindowOptions_.targetSchemaName + ";", &stmtBindParameterInfoList);
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::SnapshotWindow::CreateTargetTable_(
+    _In_ SqliteManager& sqliteManager,
+    _In_ uint32_t tableIndex
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const std::string& tableName = snapshotWindowOptions_.tableNameList[tableIndex];
+    std::string columnsDefinition;
+    std::string columnDeclaredType;
+    uint32_t tableColumnCount = 0;
+    std::vector<StmtBindParameterInfo> stmtBindParameterInfoList(1);
+
+    // 원본 테이블의 컬럼 이름과 선언 타입을 그대로 사용 (CREATE TABLE ... AS SELECT는 선언 타입을 바꿈)
+    StepCallbackFunc stepCallback = [&](const StmtInfo& stmtInfo)->CallbackErrors
+    {
+        ResultRow resultRow(stmtInfo.stmt);
+
+        if (tableColumnCount != 0)
+        {
+            columnsDefinition += ", ";
+        }
+        columnsDefinition += resultRow.Get<std::string>(0);
+
+        columnDeclaredType = resultRow.Get<std::string>(1);
+        if (columnDeclaredType.empty() == false)
+        {
+            columnsDefinition += " " + columnDeclaredType;
+        }
+
+        tableColumnCount++;
+        return CallbackErrors::kContinue;
+    };
+
+    stmtBindParameterInfoList[0].data = tableName.c_str();
+    stmtBindParameterInfoList[0].dataType = StmtDataType::kText;
+    stmtBindParameterInfoList[0].dataByteSize = static_cast<uint32_t>(tableName.length());
+
+    retValue = sqliteManager.ExecStmt("SELECT name, type FROM pragma_table_info(?, 'main');", &stmtBindParameterInfoList, &stepCallback);
+    if ((retValue != Errors::kSuccess) && (retValue != Errors::kNoResult))
+    {
+        return retValue;
+    }
+
+    // 원본 테이블이 없으면 결과 행이 없음
+    if (tableColumnCount == 0)
+    {
+        retValue = Errors::kNotFound;
+        return retValue;
+    }
+
+    retValue = sqliteManager.ExecStmt("CREATE TABLE IF NOT EXISTS " + GetTargetTableName(tableIndex) + " (" + columnsDefinition + ");");
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    if (snapshotWindowOptions_.clearTargetTable == true)
+    {
+        retValue = sqliteManager.ExecStmt("DELETE FROM " + GetTargetTableName(tableIndex) + ";");
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::SnapshotWindow::SetTableStatistics_(
+    _Inout_ SnapshotTableStatistics& snapshotTableStatistics,
+    _In_ uint64_t elapsedMicroseconds
+)
+{
+    snapshotTableStatistics.elapsedMicroseconds = elapsedMicroseconds;
+
+    if (elapsedMicroseconds == 0)
+    {
+        snapshotTableStatistics.rowsPerSecond = 0;
+    }
+    else
+    {
+        snapshotTableStatistics.rowsPerSecond = static_cast<double>(snapshotTableStatistics.copiedRowCount) * 1000000 / elapsedMicroseconds;
+    }
+}
\ No newline at end of file
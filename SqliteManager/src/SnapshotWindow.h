@@ -0,0 +1,108 @@
+#pragma once
+
+#include "SqliteManager.h"
+
+namespace EzSqlite
+{
+
+enum class SnapshotTarget
+{
+    kMain,          // 원본 Database의 <tableName><targetTableSuffix> (기존 main.cpp 방식, 복사하는 동안 쓰기 잠금 보유)
+    kTemp,          // temp 스키마 (temp_store에 따라 메모리 또는 임시 파일, 복사한 연결에서만 보임)
+    kAttached       // targetDatabasePath를 targetSchemaName으로 ATTACH (":memory:"이면 메모리 Database)
+};
+
+struct SnapshotWindowOptions
+{
+    SnapshotWindowOptions()
+    {
+        timeStampColumnName = "C_TimeStamp";
+        targetTableSuffix = "_TEMP";
+        snapshotTarget = SnapshotTarget::kMain;
+        targetSchemaName = "SNAPSHOT";
+        targetDatabasePath = L":memory:";
+        clearTargetTable = true;
+    };
+
+    std::vector<std::string> tableNameList;
+    std::string timeStampColumnName;
+    std::string targetTableSuffix;          // 대상 테이블이 없으면 원본 테이블의 컬럼 선언으로 생성
+    SnapshotTarget snapshotTarget;
+    std::string targetSchemaName;           // kAttached
+    std::wstring targetDatabasePath;        // kAttached
+    bool clearTargetTable;                  // 복사 전에 대상 테이블의 기존 행 삭제
+};
+
+struct SnapshotTableStatistics
+{
+    SnapshotTableStatistics()
+    {
+        copiedRowCount = 0;
+        elapsedMicroseconds = 0;
+        rowsPerSecond = 0;
+    };
+
+    std::string tableName;
+    uint64_t copiedRowCount;
+    uint64_t elapsedMicroseconds;   // 대상 테이블 생성, 비우기 포함
+    double rowsPerSecond;
+};
+
+struct SnapshotWindowStatistics
+{
+    SnapshotWindowStatistics()
+    {
+        totalCopiedRowCount = 0;
+        elapsedMicroseconds = 0;
+    };
+
+    std::vector<SnapshotTableStatistics> tableStatisticsList;  // tableNameList 순서
+    uint64_t totalCopiedRowCount;
+    uint64_t elapsedMicroseconds;
+};
+
+/*
+    여러 이벤트 테이블에서 C_TimeStamp가 [beginTimeStamp, endTimeStamp]인 행을 같은 시점 기준으로 <tableName><targetTableSuffix>에 복사
+
+    트랜잭션 하나 안에서 테이블마다 INSERT ... SELECT를 실행하므로 모든 테이블이 같은 읽기 스냅샷에서 복사됨
+    kTemp, kAttached는 원본 Database에 읽기 잠금만 사용하므로 WAL 모드에서는 복사하는 동안 다른 연결의 쓰기를 막지 않음
+    kAttached는 복사 후에도 ATTACH된 상태로 유지 (DetachTarget으로 해제)
+
+    테이블별 병렬 복사는 하지 않음
+    대상이 Database 하나라서 INSERT는 결국 한 연결에서 차례로 실행되고,
+    다른 연결에서 읽은 행을 다시 Bind해서 INSERT하는 비용이 SQLite 내부의 INSERT ... SELECT보다 훨씬 큼
+*/
+class SnapshotWindow
+{
+public:
+    explicit SnapshotWindow(_In_ const SnapshotWindowOptions& snapshotWindowOptions);
+
+    SnapshotWindow(const SnapshotWindow&) = delete;
+    SnapshotWindow& operator=(const SnapshotWindow&) = delete;
+
+    // sqliteManager가 원본이자 대상 (트랜잭션 밖에서 호출해야 됨)
+    Errors Copy(
+        _In_ SqliteManager& sqliteManager,
+        _In_ uint64_t beginTimeStamp,
+        _In_ uint64_t endTimeStamp,
+        _Out_opt_ SnapshotWindowStatistics* snapshotWindowStatistics = nullptr
+    );
+
+    // kAttached 대상 Database DETACH (ATTACH되어 있지 않으면 kSuccess)
+    Errors DetachTarget(_In_ SqliteManager& sqliteManager);
+
+    // 대상 테이블의 전체 이름 (schema.tableName<targetTableSuffix>)
+    std::string GetTargetTableName(_In_ uint32_t tableIndex) const;
+
+private:
+    std::string GetTargetSchemaName_() const;
+    std::string GetSelectStmtString_(_In_ uint32_t tableIndex) const;
+    Errors AttachTarget_(_In_ SqliteManager& sqliteManager);
+    Errors CreateTargetTable_(_In_ SqliteManager& sqliteManager, _In_ uint32_t tableIndex);
+    static void SetTableStatistics_(_Inout_ SnapshotTableStatistics& snapshotTableStatistics, _In_ uint64_t elapsedMicroseconds);
+
+private:
+    SnapshotWindowOptions snapshotWindowOptions_;
+};
+
+} // namespace EzSqlite
\ No newline at end of file
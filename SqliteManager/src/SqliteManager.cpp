@@ -3,6 +3,23 @@
 EzSqlite::SqliteManager::SqliteManager()
 {
     database_ = nullptr;
+    schemaFingerprintStmt_ = nullptr;
+    for (auto& pragmaStmt : pragmaStmtList_)
+    {
+        pragmaStmt = nullptr;
+    }
+    preparedStmtGeneration_ = 0;
+
+    stmtCacheSize_ = kDefaultStmtCacheSize;
+    stmtCacheStatistics_ = StmtCacheStatistics();
+
+    busyBackoffRandom_.seed(std::random_device()());
+    busyHandlerInvoked_ = false;
+
+    dataChangeNotificationCallback_ = nullptr;
+    dataChangeNotificationCallbackUserContext_ = nullptr;
+    batchDataChangeNotificationCallback_ = nullptr;
+    batchDataChangeNotificationCallbackUserContext_ = nullptr;
 }
 
 EzSqlite::SqliteManager::~SqliteManager()
@@ -17,7 +34,8 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
     _In_opt_ FPDataChangeNotificationCallback dataChangeNotificationCallback,
     _In_opt_ void* dataChangeNotificationCallbackUserContext,
     _In_ const std::vector<std::string>& verifyTableStmtStringList,
-    _In_opt_ const std::vector<std::string>* createTableStmtStringList /*= nullptr*/
+    _In_opt_ const std::vector<std::string>* createTableStmtStringList /*= nullptr*/,
+    _In_opt_ const OpenOptions* openOptions /*= nullptr*/
 )
 {
     Errors retValue = Errors::kUnsuccess;
@@ -36,14 +54,14 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
             }
         });
 
-    // SQLite Database ִ 
+    // SQLite Database가 열려있는 경우
     if (database_ != nullptr)
     {
         if (creationDisposition == CreationDisposition::kOpenAlways ||
             creationDisposition == CreationDisposition::kOpenExisting)
         {
-            // ִ Database ΰ  ̺    kAlreadyOpen 
-            if ((databasePath_ == databasePath) && (VerifyTable_(verifyTableStmtStringList) == Errors::kSuccess))
+            // 열려있는 Database와 경로가 같고 테이블 구조가 같은 경우 kAlreadyOpen 리턴
+            if ((databasePath_ == databasePath) && (VerifyTableWithCache_(databasePath, verifyTableStmtStringList) == Errors::kSuccess))
             {
                 retValue = Errors::kAlreadyOpen;
                 return retValue;
@@ -57,16 +75,16 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
     }
 
     //
-    //   
+    // 인자 검증 
     //
 
-    // kReadOnly Ϸ kOpenExisting ̾ 
+    // kReadOnly를 지정하려면 kOpenExisting 값이어야 됨
     if (desiredAccess == DesiredAccess::kReadOnly && creationDisposition != CreationDisposition::kOpenExisting)
     {
         return retValue;
     }
 
-    // ̺  ɾ   kOpenExisting ̾ 
+    // 테이블 생성 명령어를 지정하지 않으려면 kOpenExisting 값이어야 됨
     if (createTableStmtStringList == nullptr && creationDisposition != CreationDisposition::kOpenExisting)
     {
         return retValue;
@@ -80,6 +98,11 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
         }
     }
 
+    if ((openOptions != nullptr) && (openOptions->overrideBusyOptions == true))
+    {
+        busyOptions_ = openOptions->busyOptions;
+    }
+
     databasePathUtf8 = convert.to_bytes(databasePath);
     if (desiredAccess == DesiredAccess::kReadOnly)
     {
@@ -91,9 +114,16 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
     }
 
     sqliteStatus = sqlite3_open_v2(databasePathUtf8.c_str(), &database_, openFlags, nullptr);
-    if ((sqliteStatus != SQLITE_OK) || (VerifyTable_(verifyTableStmtStringList) != Errors::kSuccess))
+    if (sqliteStatus == SQLITE_OK)
     {
-        // sqlite3_open_v2 Լ ص database_    
+        ApplyBusyHandler_();
+    }
+
+    // 열기, 테이블 검증에 실패한 경우에만 Database를 다시 생성
+    if ((sqliteStatus != SQLITE_OK) ||
+        (VerifyTableWithCache_(databasePath, verifyTableStmtStringList) != Errors::kSuccess))
+    {
+        // sqlite3_open_v2 함수가 실패해도 database_ 엔 값이 리턴 됨
         if (this->CloseDatabase() != Errors::kSuccess)
         {
             return retValue;
@@ -117,7 +147,16 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
             return retValue;
         }
 
-        // ̺ 
+        ApplyBusyHandler_();
+
+        // page_size는 테이블이 생성되기 전에 적용되어야 됨
+        if (ApplyOpenOptions_(openOptions, desiredAccess) != Errors::kSuccess)
+        {
+            this->CloseDatabase();
+            return retValue;
+        }
+
+        // 테이블 생성
         if (createTableStmtStringList->size() == 0)
         {
             return retValue;
@@ -136,6 +175,15 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
             }
         }
     }
+    else
+    {
+        // 옵션 적용 실패(다른 연결이 사용 중이라 journal_mode를 WAL로 바꾸지 못한 경우 등)는 Database 문제가 아니므로 다시 생성하지 않음
+        if (ApplyOpenOptions_(openOptions, desiredAccess) != Errors::kSuccess)
+        {
+            this->CloseDatabase();
+            return retValue;
+        }
+    }
 
     retValue = PrepareInternalStmt_();
     if (retValue != Errors::kSuccess)
@@ -143,14 +191,9 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
         return retValue;
     }
 
-    if (dataChangeNotificationCallback != nullptr)
-    {
-        SqliteUpdateHook_(
-            database_,
-            dataChangeNotificationCallback,
-            dataChangeNotificationCallbackUserContext
-        );
-    }
+    dataChangeNotificationCallback_ = dataChangeNotificationCallback;
+    dataChangeNotificationCallbackUserContext_ = dataChangeNotificationCallbackUserContext;
+    ApplyDataChangeHook_();
 
     databasePath_ = databasePath;
 
@@ -159,8 +202,7 @@ EzSqlite::Errors EzSqlite::SqliteManager::CreateDatabase(
 }
 
 EzSqlite::Errors EzSqlite::SqliteManager::CloseDatabase(
-    _In_opt_ bool deleteDatabase, /*= false*/ // true ̹  쿣  Ұ
-    _In_opt_ bool resetPreparedStmtIndex /*= false*/
+    _In_opt_ bool deleteDatabase /*= false*/ // true여도 이미 닫힌 경우엔 제거 불가
 )
 {
     Errors retValue = Errors::kUnsuccess;
@@ -181,10 +223,26 @@ EzSqlite::Errors EzSqlite::SqliteManager::CloseDatabase(
         return retValue;
     }
 
-    this->ClearPreparedStmt(resetPreparedStmtIndex);
+    this->ClearPreparedStmt();
+    this->ClearStmtCache();
+
+    if (schemaFingerprintStmt_ != nullptr)
+    {
+        sqlite3_finalize(schemaFingerprintStmt_);
+        schemaFingerprintStmt_ = nullptr;
+    }
+
+    for (auto& pragmaStmt : pragmaStmtList_)
+    {
+        if (pragmaStmt != nullptr)
+        {
+            sqlite3_finalize(pragmaStmt);
+            pragmaStmt = nullptr;
+        }
+    }
 
     /*
-         尡 WAL  database read/write   ־ sqlite3_close  .shm, .wal   
+        저널 모드가 WAL인 경우 database가 read/write 로 열려 있어야 sqlite3_close할 때 .shm, .wal 파일이 정리 됨
     */
     sqliteStatus = sqlite3_close(database_);
     if (sqliteStatus != SQLITE_OK)
@@ -199,6 +257,12 @@ EzSqlite::Errors EzSqlite::SqliteManager::CloseDatabase(
 
     database_ = nullptr;
 
+    // 열린 트랜잭션은 sqlite3_close에서 ROLLBACK Hook 없이 취소됨
+    pendingDataChangeRangeList_.clear();
+    openDataChangeRangeIndexList_.clear();
+    committedDataChangeRangeList_.clear();
+    dataChangeNameList_.clear();
+
     if (deleteDatabase == true)
     {
         if ((::DeleteFileW(databasePath_.c_str()) == FALSE) && (GetLastError() != ERROR_FILE_NOT_FOUND))
@@ -216,7 +280,7 @@ EzSqlite::Errors EzSqlite::SqliteManager::CloseDatabase(
 EzSqlite::Errors EzSqlite::SqliteManager::PrepareStmt(
     _In_ const std::string& stmtString,
     _In_opt_ uint32_t prepareFlags /*= SQLITE_PREPARE_PERSISTENT*/,
-    _Out_opt_ uint32_t* preparedStmtIndex /*= nullptr*/
+    _Out_opt_ StmtHandle* preparedStmtHandle /*= nullptr*/
 )
 {
     Errors retValue = Errors::kUnsuccess;
@@ -224,6 +288,7 @@ EzSqlite::Errors EzSqlite::SqliteManager::PrepareStmt(
     int sqliteStatus = SQLITE_ERROR;
 
     StmtInfo stmtInfo;
+    uint32_t preparedStmtSlotIndex = 0;
 
     auto raii = RAIIRegister([&]
         {
@@ -239,8 +304,8 @@ EzSqlite::Errors EzSqlite::SqliteManager::PrepareStmt(
         return retValue;
     }
 
-    // Pragma ɹ  Prepare ص Ǿ 찡 ֱ 
-    // ExecStmt ޼θ ϰ PrepareStmt  Ұ
+    // Pragma 명령문의 경우 Prepare만 해도 적용되어버리는 경우가 있기 때문에
+    // ExecStmt 메서드로만 실행하고 PrepareStmt에 등록 불가
     if (GetStmtType_(stmtString.c_str()) == StmtType::kPragma)
     {
         return retValue;
@@ -261,52 +326,112 @@ EzSqlite::Errors EzSqlite::SqliteManager::PrepareStmt(
 
     GetStmtInfo_(stmtInfo);
 
-    preparedStmtInfoList_.push_back(stmtInfo);
-    preparedStmtIndexPointerList_.push_back(preparedStmtIndex);
+    if (freePreparedStmtSlotIndexList_.size() != 0)
+    {
+        preparedStmtSlotIndex = freePreparedStmtSlotIndexList_.back();
+        freePreparedStmtSlotIndexList_.pop_back();
+    }
+    else
+    {
+        preparedStmtSlotIndex = static_cast<uint32_t>(preparedStmtSlotList_.size());
+        preparedStmtSlotList_.emplace_back();
+    }
+
+    // generation 0은 빈 슬롯을 의미하므로 건너뜀
+    if (++preparedStmtGeneration_ == 0)
+    {
+        ++preparedStmtGeneration_;
+    }
+
+    preparedStmtSlotList_[preparedStmtSlotIndex].stmtInfo = stmtInfo;
+    preparedStmtSlotList_[preparedStmtSlotIndex].generation = preparedStmtGeneration_;
+    preparedStmtIndexMap_.emplace(stmtInfo.stmtStringHash, preparedStmtSlotIndex);
 
-    if (preparedStmtIndex != nullptr)
+    if (preparedStmtHandle != nullptr)
     {
-        *preparedStmtIndex = static_cast<uint32_t>(preparedStmtInfoList_.size()) - 1;
+        preparedStmtHandle->index = preparedStmtSlotIndex;
+        preparedStmtHandle->generation = preparedStmtGeneration_;
     }
 
     retValue = Errors::kSuccess;
     return retValue;
 }
 
-void EzSqlite::SqliteManager::ClearPreparedStmt(
-    _In_opt_ bool resetPreparedStmtIndex /*= false*/
+EzSqlite::Errors EzSqlite::SqliteManager::FinalizePreparedStmt(
+    _In_ StmtHandle preparedStmtHandle
 )
 {
-    if (preparedStmtInfoList_.size() == 0)
+    Errors retValue = Errors::kNotFound;
+
+    const StmtInfo* preparedStmtInfo = nullptr;
+
+    retValue = FindPreparedStmt(preparedStmtHandle, preparedStmtInfo);
+    if (retValue != Errors::kSuccess)
     {
-        return;
+        return retValue;
+    }
+
+    PreparedStmtSlot& preparedStmtSlot = preparedStmtSlotList_[preparedStmtHandle.index];
+
+    auto preparedStmtIndexRange = preparedStmtIndexMap_.equal_range(preparedStmtSlot.stmtInfo.stmtStringHash);
+    for (auto preparedStmtIndexEntry = preparedStmtIndexRange.first; preparedStmtIndexEntry != preparedStmtIndexRange.second; ++preparedStmtIndexEntry)
+    {
+        if (preparedStmtIndexEntry->second == preparedStmtHandle.index)
+        {
+            preparedStmtIndexMap_.erase(preparedStmtIndexEntry);
+            break;
+        }
     }
 
-    for (uint32_t preparedStmtIndex = 0; preparedStmtIndex < preparedStmtInfoList_.size(); preparedStmtIndex++)
+    sqlite3_finalize(preparedStmtSlot.stmtInfo.stmt);
+    preparedStmtSlot.stmtInfo = StmtInfo();
+    preparedStmtSlot.generation = 0;
+
+    freePreparedStmtSlotIndexList_.push_back(preparedStmtHandle.index);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::SqliteManager::FinalizePreparedStmt(
+    _In_ const std::string& stmtStringPrefix
+)
+{
+    StmtHandle preparedStmtHandle;
+
+    for (uint32_t preparedStmtSlotIndex = 0; preparedStmtSlotIndex < preparedStmtSlotList_.size(); preparedStmtSlotIndex++)
     {
-        if (preparedStmtInfoList_[preparedStmtIndex].stmt != nullptr)
+        const PreparedStmtSlot& preparedStmtSlot = preparedStmtSlotList_[preparedStmtSlotIndex];
+
+        if ((preparedStmtSlot.generation != 0) && (preparedStmtSlot.stmtInfo.stmtString.compare(0, stmtStringPrefix.length(), stmtStringPrefix) == 0))
         {
-            sqlite3_finalize(preparedStmtInfoList_[preparedStmtIndex].stmt);
-            preparedStmtInfoList_[preparedStmtIndex].stmt = nullptr;
+            preparedStmtHandle.index = preparedStmtSlotIndex;
+            preparedStmtHandle.generation = preparedStmtSlot.generation;
+            FinalizePreparedStmt(preparedStmtHandle);
         }
+    }
+}
+
+void EzSqlite::SqliteManager::ClearPreparedStmt()
+{
+    if (preparedStmtSlotList_.size() == 0)
+    {
+        return;
+    }
 
-        if (resetPreparedStmtIndex == true)
+    // 슬롯이 제거되어도 preparedStmtGeneration_은 계속 증가하므로 이전에 발급된 핸들은 kNotFound로 검출됨
+    for (auto& preparedStmtSlotListEntry : preparedStmtSlotList_)
+    {
+        if (preparedStmtSlotListEntry.stmtInfo.stmt != nullptr)
         {
-            // Prepared Statement  Ǳ  Pointer List Index Stmt Index .
-            __try
-            {
-                if ((preparedStmtIndexPointerList_[preparedStmtIndex] != nullptr) &&
-                    (*(preparedStmtIndexPointerList_[preparedStmtIndex]) == preparedStmtIndex))
-                {
-                    *(preparedStmtIndexPointerList_[preparedStmtIndex]) = static_cast<uint32_t>(StmtIndex::kNoIndex);
-                }
-            }
-            __except (EXCEPTION_EXECUTE_HANDLER) {}
+            sqlite3_finalize(preparedStmtSlotListEntry.stmtInfo.stmt);
+            preparedStmtSlotListEntry.stmtInfo.stmt = nullptr;
         }
     }
 
-    preparedStmtInfoList_.clear();
-    preparedStmtIndexPointerList_.clear();
+    preparedStmtSlotList_.clear();
+    freePreparedStmtSlotIndexList_.clear();
+    preparedStmtIndexMap_.clear();
 }
 
 EzSqlite::Errors EzSqlite::SqliteManager::FindPreparedStmt(
@@ -316,14 +441,21 @@ EzSqlite::Errors EzSqlite::SqliteManager::FindPreparedStmt(
 {
     Errors retValue = Errors::kNotFound;
 
-    if (preparedStmtInfoList_.size() == 0)
+    uint64_t preparedStmtStringHash = 0;
+
+    if (preparedStmtIndexMap_.size() == 0)
     {
         return retValue;
     }
 
-    for (const auto& preparedStmtInfoListEntry : preparedStmtInfoList_)
+    preparedStmtStringHash = GetStmtStringHash_(preparedStmtString.c_str(), preparedStmtString.length());
+
+    auto preparedStmtIndexRange = preparedStmtIndexMap_.equal_range(preparedStmtStringHash);
+    for (auto preparedStmtIndexEntry = preparedStmtIndexRange.first; preparedStmtIndexEntry != preparedStmtIndexRange.second; ++preparedStmtIndexEntry)
     {
-        if (strcmp(preparedStmtInfoListEntry.stmtString.c_str(), preparedStmtString.c_str()) == 0)
+        // 해시 충돌 대비 문자열 비교
+        const StmtInfo& preparedStmtInfoListEntry = preparedStmtSlotList_[preparedStmtIndexEntry->second].stmtInfo;
+        if (preparedStmtInfoListEntry.stmtString == preparedStmtString)
         {
             preparedStmtInfo = &preparedStmtInfoListEntry;
 
@@ -336,23 +468,29 @@ EzSqlite::Errors EzSqlite::SqliteManager::FindPreparedStmt(
 }
 
 EzSqlite::Errors EzSqlite::SqliteManager::FindPreparedStmt(
-    _In_ uint32_t preparedStmtIndex,
+    _In_ StmtHandle preparedStmtHandle,
     _Out_ const StmtInfo*& preparedStmtInfo
 )
 {
     Errors retValue = Errors::kNotFound;
 
-    if (preparedStmtIndex == static_cast<uint32_t>(StmtIndex::kNoIndex))
+    if (preparedStmtHandle.generation == 0)
+    {
+        return retValue;
+    }
+
+    if (preparedStmtSlotList_.size() <= preparedStmtHandle.index)
     {
         return retValue;
     }
 
-    if (preparedStmtInfoList_.size() <= preparedStmtIndex)
+    // 제거되었거나 다른 명령문이 재사용 중인 슬롯
+    if (preparedStmtSlotList_[preparedStmtHandle.index].generation != preparedStmtHandle.generation)
     {
         return retValue;
     }
 
-    preparedStmtInfo = &(preparedStmtInfoList_[preparedStmtIndex]);
+    preparedStmtInfo = &(preparedStmtSlotList_[preparedStmtHandle.index].stmtInfo);
 
     retValue = Errors::kSuccess;
     return retValue;
@@ -370,6 +508,11 @@ EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt(
 
     const StmtInfo* preparedStmtInfo = nullptr;
     StmtInfo stmtInfo;
+    StmtType stmtType = StmtType::kUnknown;
+    StmtCacheEntry* stmtCacheEntry = nullptr;
+
+    const StmtBindParameterInfo* stmtBindParameterInfoArray = nullptr;
+    uint32_t stmtBindParameterInfoCount = 0;
 
     auto raii = RAIIRegister([&]
         {
@@ -378,831 +521,2584 @@ EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt(
                 sqlite3_finalize(stmtInfo.stmt);
                 stmtInfo.stmt = nullptr;
             }
-        });
 
-    if (database_ == nullptr)
-    {
-        return retValue;
-    }
-
-    retValue = FindPreparedStmt(stmtString, preparedStmtInfo);
-    if (retValue == Errors::kNotFound)
-    {
-        if (GetStmtType_(stmtString.c_str()) != StmtType::kPragma)
-        {
-            sqliteStatus = SqlitePrepareV3_(
-                database_,
-                stmtString.c_str(),
-                -1,
-                SQLITE_PREPARE_PERSISTENT,
-                &stmtInfo.stmt,
-                nullptr
-            );
-            if (sqliteStatus != SQLITE_OK)
+            if (stmtCacheEntry != nullptr)
             {
-                retValue = Errors::kUnsuccess;
-                return retValue;
+                stmtCacheEntry->inUse = false;
+                TrimStmtCache_();
             }
-
-            GetStmtInfo_(stmtInfo);
-        }
-        else
-        {
-            SetPragmaStmtInfo_(stmtString, stmtInfo);
-        }
-    }
-
-    return ExecStmt_(stmtInfo, stmtBindParameterInfoList, stmtStepCallback);
-}
-
-EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt(
-    _In_ uint32_t preparedStmtIndex,
-    _In_opt_ const std::vector<StmtBindParameterInfo>* stmtBindParameterInfoList /*= nullptr */,
-    _In_opt_ StepCallbackFunc* stmtStepCallback /*= nullptr*/
-)
-{
-    Errors retValue = Errors::kUnsuccess;
-
-    const StmtInfo* stmtInfo = nullptr;
+        });
 
     if (database_ == nullptr)
     {
         return retValue;
     }
 
-    retValue = FindPreparedStmt(preparedStmtIndex, stmtInfo);
-    if (retValue != Errors::kSuccess)
+    if (stmtBindParameterInfoList != nullptr)
     {
-        return retValue;
+        stmtBindParameterInfoArray = stmtBindParameterInfoList->data();
+        stmtBindParameterInfoCount = static_cast<uint32_t>(stmtBindParameterInfoList->size());
     }
 
-    return ExecStmt_(*stmtInfo, stmtBindParameterInfoList, stmtStepCallback);
-}
-
-EzSqlite::Errors EzSqlite::SqliteManager::PrepareInternalStmt_()
-{
-    Errors retValue = Errors::kUnsuccess;
-
-    auto raii = RAIIRegister([&]
-        {
-            if (retValue != Errors::kSuccess)
-            {
-                this->ClearPreparedStmt();
-            }
-        });
-
-    retValue = this->PrepareStmt("BEGIN;");
-    if (retValue != Errors::kSuccess)
+    retValue = FindPreparedStmt(stmtString, preparedStmtInfo);
+    if (retValue == Errors::kSuccess)
     {
-        return retValue;
+        return ExecStmt_(*preparedStmtInfo, stmtBindParameterInfoArray, stmtBindParameterInfoCount, stmtStepCallback);
     }
 
-    retValue = this->PrepareStmt("BEGIN IMMEDIATE;");
-    if (retValue != Errors::kSuccess)
+    stmtType = GetStmtType_(stmtString.c_str());
+    if (stmtType == StmtType::kPragma)
     {
-        return retValue;
+        SetPragmaStmtInfo_(stmtString, stmtInfo);
+        return ExecStmt_(stmtInfo, stmtBindParameterInfoArray, stmtBindParameterInfoCount, stmtStepCallback);
     }
 
-    retValue = this->PrepareStmt("COMMIT;");
-    if (retValue != Errors::kSuccess)
+    // 반복 실행되는 DML/SELECT 명령문은 Prepare 결과를 캐시해서 재사용
+    if ((stmtType == StmtType::kSelect) ||
+        (stmtType == StmtType::kInsert) ||
+        (stmtType == StmtType::kUpdate) ||
+        (stmtType == StmtType::kDelete))
     {
-        return retValue;
+        retValue = AcquireCachedStmt_(stmtString, stmtCacheEntry);
+        if (retValue == Errors::kUnsuccess)
+        {
+            return retValue;
+        }
+        else if (retValue == Errors::kSuccess)
+        {
+            // sqlite3_reset, sqlite3_clear_bindings는 ExecStmt_ 종료 시 호출되므로 재사용 시점엔 초기 상태
+            return ExecStmt_(stmtCacheEntry->stmtInfo, stmtBindParameterInfoArray, stmtBindParameterInfoCount, stmtStepCallback);
+        }
     }
 
-    retValue = this->PrepareStmt("ROLLBACK;");
-    if (retValue != Errors::kSuccess)
+    sqliteStatus = SqlitePrepareV3_(
+        database_,
+        stmtString.c_str(),
+        -1,
+        SQLITE_PREPARE_PERSISTENT,
+        &stmtInfo.stmt,
+        nullptr
+    );
+    if (sqliteStatus != SQLITE_OK)
     {
+        retValue = Errors::kUnsuccess;
         return retValue;
     }
 
-    retValue = this->PrepareStmt("VACUUM;");
-    if (retValue != Errors::kSuccess)
-    {
-        return retValue;
-    }
+    GetStmtInfo_(stmtInfo);
 
-    retValue = Errors::kSuccess;
-    return retValue;
+    return ExecStmt_(stmtInfo, stmtBindParameterInfoArray, stmtBindParameterInfoCount, stmtStepCallback);
 }
 
-void EzSqlite::SqliteManager::GetStmtInfo_(
-    _Inout_ StmtInfo& stmtInfo
+void EzSqlite::SqliteManager::SetStmtCacheSize(
+    _In_ uint32_t stmtCacheSize
 )
 {
-    if (stmtInfo.stmt == nullptr)
+    stmtCacheSize_ = stmtCacheSize;
+    TrimStmtCache_();
+}
+
+void EzSqlite::SqliteManager::ClearStmtCache()
+{
+    for (auto& stmtCacheListEntry : stmtCacheList_)
     {
-        return;
+        if (stmtCacheListEntry.stmtInfo.stmt != nullptr)
+        {
+            sqlite3_finalize(stmtCacheListEntry.stmtInfo.stmt);
+            stmtCacheListEntry.stmtInfo.stmt = nullptr;
+        }
     }
 
-    stmtInfo.stmtString.assign(GetPreparedStmtString_(stmtInfo.stmt));
-    stmtInfo.stmtType = GetStmtType_(stmtInfo.stmtString.c_str());
-    stmtInfo.columnCount = sqlite3_column_count(stmtInfo.stmt);
-    stmtInfo.bindParameterCount = sqlite3_bind_parameter_count(stmtInfo.stmt);
+    stmtCacheList_.clear();
+    stmtCacheIndexMap_.clear();
+}
 
-    return;
+void EzSqlite::SqliteManager::GetStmtCacheStatistics(
+    _Out_ StmtCacheStatistics& stmtCacheStatistics
+)
+{
+    stmtCacheStatistics = stmtCacheStatistics_;
+    stmtCacheStatistics.cachedStmtCount = static_cast<uint32_t>(stmtCacheList_.size());
 }
 
-EzSqlite::StmtType EzSqlite::SqliteManager::GetStmtType_(
-    _In_ const std::string::traits_type::char_type* stmtString
+void EzSqlite::SqliteManager::SetBusyOptions(
+    _In_ const BusyOptions& busyOptions
 )
 {
-    uint32_t stmtStringLength = static_cast<uint32_t>(strlen(stmtString));
+    busyOptions_ = busyOptions;
+    ApplyBusyHandler_();
+}
 
-    if ((strlen("ALTER TABLE") <= stmtStringLength) && (_strnicmp("ALTER TABLE", stmtString, strlen("ALTER TABLE")) == 0))
-    {
-        return StmtType::kAlterTable;
-    }
-    else if ((strlen("ANALYZE") <= stmtStringLength) && (_strnicmp("ANALYZE", stmtString, strlen("ANALYZE")) == 0))
-    {
-        return StmtType::kAnalyze;
-    }
-    else if ((strlen("ATTACH") <= stmtStringLength) && (_strnicmp("ATTACH", stmtString, strlen("ATTACH")) == 0))
-    {
-        return StmtType::kAttach;
-    }
-    else if ((strlen("BEGIN") <= stmtStringLength) && (_strnicmp("BEGIN", stmtString, strlen("BEGIN")) == 0))
-    {
-        return StmtType::kBegin;
-    }
-    else if ((strlen("COMMIT") <= stmtStringLength) && (_strnicmp("COMMIT", stmtString, strlen("COMMIT")) == 0))
+EzSqlite::Errors EzSqlite::SqliteManager::ApplyOpenOptions_(
+    _In_opt_ const OpenOptions* openOptions,
+    _In_ DesiredAccess desiredAccess
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::vector<PragmaSetting> pragmaSettingList;
+
+    const char* const kJournalModeNameList[] = { "", "DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF" };
+    const char* const kSynchronousModeNameList[] = { "", "OFF", "NORMAL", "FULL", "EXTRA" };
+    const char* const kAutoVacuumModeNameList[] = { "", "NONE", "FULL", "INCREMENTAL" };
+    const char* const kTempStoreNameList[] = { "", "FILE", "MEMORY" };
+    const char* const kLockingModeNameList[] = { "", "NORMAL", "EXCLUSIVE" };
+
+    if (openOptions == nullptr)
     {
-        return StmtType::kCommit;
+        retValue = Errors::kSuccess;
+        return retValue;
     }
-    else if (((strlen("CREATE INDEX") <= stmtStringLength) && (_strnicmp("CREATE INDEX", stmtString, strlen("CREATE INDEX")) == 0)) ||
-        ((strlen("CREATE UNIQUE INDEX") <= stmtStringLength) && (_strnicmp("CREATE UNIQUE INDEX", stmtString, strlen("CREATE UNIQUE INDEX")) == 0)))
+
+    // page_size, auto_vacuum, locking_mode는 journal_mode를 WAL로 바꾸기 전에 적용되어야 됨
+    if ((openOptions->pageSize != 0) && (desiredAccess == DesiredAccess::kReadWrite))
     {
-        return StmtType::kCreateIndex;
+        pragmaSettingList.emplace_back(Pragma::kPageSize, openOptions->pageSize);
     }
-    else if (((strlen("CREATE TABLE") <= stmtStringLength) && (_strnicmp("CREATE TABLE", stmtString, strlen("CREATE TABLE")) == 0)) ||
-        ((strlen("CREATE TEMP TABLE") <= stmtStringLength) && (_strnicmp("CREATE TEMP TABLE", stmtString, strlen("CREATE TEMP TABLE")) == 0)) ||
-        ((strlen("CREATE TEMPORARY TABLE") <= stmtStringLength) && (_strnicmp("CREATE TEMPORARY TABLE", stmtString, strlen("CREATE TEMPORARY TABLE")) == 0)))
+    if ((openOptions->autoVacuumMode != AutoVacuumMode::kUnchanged) && (desiredAccess == DesiredAccess::kReadWrite))
     {
-        return StmtType::kCreateTable;
+        pragmaSettingList.emplace_back(Pragma::kAutoVacuum, kAutoVacuumModeNameList[static_cast<uint32_t>(openOptions->autoVacuumMode)]);
     }
-    else if (((strlen("CREATE TRIGGER") <= stmtStringLength) && (_strnicmp("CREATE TRIGGER", stmtString, strlen("CREATE TRIGGER")) == 0)) ||
-        ((strlen("CREATE TEMP TRIGGER") <= stmtStringLength) && (_strnicmp("CREATE TEMP TRIGGER", stmtString, strlen("CREATE TEMP TRIGGER")) == 0)) ||
-        ((strlen("CREATE TEMPORARY TRIGGER") <= stmtStringLength) && (_strnicmp("CREATE TEMPORARY TRIGGER", stmtString, strlen("CREATE TEMPORARY TRIGGER")) == 0)))
+    if (openOptions->lockingMode != LockingMode::kUnchanged)
     {
-        return StmtType::kCreateTrigger;
+        pragmaSettingList.emplace_back(Pragma::kLockingMode, kLockingModeNameList[static_cast<uint32_t>(openOptions->lockingMode)]);
     }
-    else if (((strlen("CREATE VIEW") <= stmtStringLength) && (_strnicmp("CREATE VIEW", stmtString, strlen("CREATE VIEW")) == 0)) ||
-        ((strlen("CREATE TEMP VIEW") <= stmtStringLength) && (_strnicmp("CREATE TEMP VIEW", stmtString, strlen("CREATE TEMP VIEW")) == 0)) ||
-        ((strlen("CREATE TEMPORARY VIEW") <= stmtStringLength) && (_strnicmp("CREATE TEMPORARY VIEW", stmtString, strlen("CREATE TEMPORARY VIEW")) == 0)))
+    if ((openOptions->journalMode != JournalMode::kUnchanged) && (desiredAccess == DesiredAccess::kReadWrite))
     {
-        return StmtType::kCreateView;
+        pragmaSettingList.emplace_back(Pragma::kJournalMode, kJournalModeNameList[static_cast<uint32_t>(openOptions->journalMode)]);
     }
-    else if ((strlen("CREATE VIRTUAL TABLE") <= stmtStringLength) && (_strnicmp("CREATE VIRTUAL TABLE", stmtString, strlen("CREATE VIRTUAL TABLE")) == 0))
+    if (openOptions->synchronousMode != SynchronousMode::kUnchanged)
     {
-        return StmtType::kCreateVirtualTable;
+        pragmaSettingList.emplace_back(Pragma::kSynchronous, kSynchronousModeNameList[static_cast<uint32_t>(openOptions->synchronousMode)]);
     }
-    else if ((strlen("DELETE FROM") <= stmtStringLength) && (_strnicmp("DELETE FROM", stmtString, strlen("DELETE FROM")) == 0))
+    if (openOptions->cacheSize != 0)
     {
-        return StmtType::kDelete;
+        pragmaSettingList.emplace_back(Pragma::kCacheSize, openOptions->cacheSize);
     }
-    else if ((strlen("DETACH") <= stmtStringLength) && (_strnicmp("DETACH", stmtString, strlen("DETACH")) == 0))
+    if (openOptions->mmapSize >= 0)
     {
-        return StmtType::kDetach;
+        pragmaSettingList.emplace_back(Pragma::kMmapSize, openOptions->mmapSize);
     }
-    else if ((strlen("DROP INDEX") <= stmtStringLength) && (_strnicmp("DROP INDEX", stmtString, strlen("DROP INDEX")) == 0))
+    if (openOptions->tempStore != TempStore::kUnchanged)
     {
-        return StmtType::kDropIndex;
+        pragmaSettingList.emplace_back(Pragma::kTempStore, kTempStoreNameList[static_cast<uint32_t>(openOptions->tempStore)]);
     }
-    else if ((strlen("DROP TABLE") <= stmtStringLength) && (_strnicmp("DROP TABLE", stmtString, strlen("DROP TABLE")) == 0))
+    if (openOptions->walAutoCheckpoint >= 0)
     {
-        return StmtType::kDropTable;
+        pragmaSettingList.emplace_back(Pragma::kWalAutoCheckpoint, openOptions->walAutoCheckpoint);
     }
-    else if ((strlen("DROP TRIGGER") <= stmtStringLength) && (_strnicmp("DROP TRIGGER", stmtString, strlen("DROP TRIGGER")) == 0))
+
+    return SetPragmaList(pragmaSettingList);
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::SetPragmaList(
+    _In_ const std::vector<PragmaSetting>& pragmaSettingList
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int sqliteStatus = SQLITE_ERROR;
+    std::string pragmaStmtString;
+
+    if (database_ == nullptr)
     {
-        return StmtType::kDropTrigger;
+        return retValue;
     }
-    else if ((strlen("DROP VIEW") <= stmtStringLength) && (_strnicmp("DROP VIEW", stmtString, strlen("DROP VIEW")) == 0))
+
+    for (const auto& pragmaSettingListEntry : pragmaSettingList)
     {
-        return StmtType::kDropView;
+        if (pragmaSettingListEntry.pragma >= Pragma::kPragmaNumber)
+        {
+            return retValue;
+        }
+
+        pragmaStmtString += "PRAGMA ";
+        pragmaStmtString += GetPragmaName_(pragmaSettingListEntry.pragma);
+        pragmaStmtString += "=";
+        pragmaStmtString += pragmaSettingListEntry.valueLiteral;
+        pragmaStmtString += ";";
     }
-    else if ((strlen("INSERT INTO") <= stmtStringLength) && (_strnicmp("INSERT INTO", stmtString, strlen("INSERT INTO")) == 0))
+
+    if (pragmaStmtString.empty() == false)
     {
-        return StmtType::kInsert;
+        // PRAGMA 설정은 다시 실행해도 결과가 같으므로 SQLITE_BUSY인 경우 처음부터 재시도
+        sqliteStatus = RetryOnBusy_(
+            [&]
+            {
+                return sqlite3_exec(database_, pragmaStmtString.c_str(), nullptr, nullptr, nullptr);
+            },
+            nullptr,
+            nullptr
+        );
+        if (sqliteStatus != SQLITE_OK)
+        {
+            return retValue;
+        }
     }
-    else if ((strlen("PRAGMA") <= stmtStringLength) && (_strnicmp("PRAGMA", stmtString, strlen("PRAGMA")) == 0))
-    {
-        return StmtType::kPragma;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+const char* EzSqlite::SqliteManager::GetPragmaName_(
+    _In_ Pragma pragma
+)
+{
+    // Pragma 열거형 순서
+    static const char* const kPragmaNameList[] =
+    {
+        "application_id",
+        "auto_vacuum",
+        "busy_timeout",
+        "cache_size",
+        "cache_spill",
+        "data_version",
+        "foreign_keys",
+        "freelist_count",
+        "incremental_vacuum",
+        "journal_mode",
+        "journal_size_limit",
+        "locking_mode",
+        "max_page_count",
+        "mmap_size",
+        "page_count",
+        "page_size",
+        "query_only",
+        "recursive_triggers",
+        "schema_version",
+        "secure_delete",
+        "synchronous",
+        "temp_store",
+        "threads",
+        "user_version",
+        "wal_autocheckpoint"
+    };
+    static_assert(_countof(kPragmaNameList) == static_cast<size_t>(Pragma::kPragmaNumber), "kPragmaNameList");
+
+    return kPragmaNameList[static_cast<uint32_t>(pragma)];
+}
+
+bool EzSqlite::SqliteManager::IsReusablePragmaStmt_(
+    _In_ Pragma pragma
+)
+{
+    // 조회 값을 Step 시점에 읽는 PRAGMA (나머지는 Prepare 시점의 값이 명령문에 상수로 들어가므로 재사용하면 안 됨)
+    switch (pragma)
+    {
+    case Pragma::kApplicationId:
+    case Pragma::kDataVersion:
+    case Pragma::kFreelistCount:
+    case Pragma::kJournalMode:
+    case Pragma::kMaxPageCount:
+    case Pragma::kPageCount:
+    case Pragma::kSchemaVersion:
+    case Pragma::kUserVersion:
+        return true;
+
+    default:
+        return false;
     }
-    else if ((strlen("REINDEX") <= stmtStringLength) && (_strnicmp("REINDEX", stmtString, strlen("REINDEX")) == 0))
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::BeginGetPragma_(
+    _In_ Pragma pragma,
+    _Out_ sqlite3_stmt*& pragmaStmt
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int sqliteStatus = SQLITE_ERROR;
+    std::string pragmaStmtString;
+    bool reusable = false;
+
+    pragmaStmt = nullptr;
+
+    auto raii = RAIIRegister([&]
+        {
+            if ((retValue != Errors::kSuccess) && (pragmaStmt != nullptr))
+            {
+                EndGetPragma_(pragma, pragmaStmt);
+                pragmaStmt = nullptr;
+            }
+        });
+
+    if ((database_ == nullptr) || (pragma >= Pragma::kPragmaNumber))
     {
-        return StmtType::kReindex;
+        return retValue;
     }
-    else if ((strlen("RELEASE") <= stmtStringLength) && (_strnicmp("RELEASE", stmtString, strlen("RELEASE")) == 0))
+
+    // 값 없이 실행하면 freelist 전체를 제거하므로 조회 불가
+    if (pragma == Pragma::kIncrementalVacuum)
     {
-        return StmtType::kRelease;
+        return retValue;
     }
-    else if ((strlen("ROLLBACK") <= stmtStringLength) && (_strnicmp("ROLLBACK", stmtString, strlen("ROLLBACK")) == 0))
+
+    reusable = IsReusablePragmaStmt_(pragma);
+    if (reusable == true)
     {
-        return StmtType::kRollback;
+        pragmaStmt = pragmaStmtList_[static_cast<uint32_t>(pragma)];
     }
-    else if ((strlen("SAVEPOINT") <= stmtStringLength) && (_strnicmp("SAVEPOINT", stmtString, strlen("SAVEPOINT")) == 0))
+
+    if (pragmaStmt == nullptr)
     {
-        return StmtType::kSavepoint;
-    }
-    else if ((strlen("SELECT") <= stmtStringLength) && (_strnicmp("SELECT", stmtString, strlen("SELECT")) == 0))
+        pragmaStmtString = std::string("PRAGMA ") + GetPragmaName_(pragma) + ";";
+
+        sqliteStatus = SqlitePrepareV3_(
+            database_,
+            pragmaStmtString.c_str(),
+            -1,
+            reusable ? SQLITE_PREPARE_PERSISTENT : 0,
+            &pragmaStmt,
+            nullptr
+        );
+        if (sqliteStatus != SQLITE_OK)
+        {
+            pragmaStmt = nullptr;
+            return retValue;
+        }
+
+        if (reusable == true)
+        {
+            pragmaStmtList_[static_cast<uint32_t>(pragma)] = pragmaStmt;
+        }
+    }
+
+    sqliteStatus = RetryOnBusy_(
+        [&]
+        {
+            return sqlite3_step(pragmaStmt);
+        },
+        pragmaStmt,
+        nullptr
+    );
+    if (sqliteStatus == SQLITE_DONE)
     {
-        return StmtType::kSelect;
+        retValue = Errors::kNoResult;
+        return retValue;
     }
-    else if ((strlen("UPDATE") <= stmtStringLength) && (_strnicmp("UPDATE", stmtString, strlen("UPDATE")) == 0))
+    else if (sqliteStatus != SQLITE_ROW)
     {
-        return StmtType::kUpdate;
+        return retValue;
     }
-    else if ((strlen("VACUUM") <= stmtStringLength) && (_strnicmp("VACUUM", stmtString, strlen("VACUUM")) == 0))
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::SqliteManager::EndGetPragma_(
+    _In_ Pragma pragma,
+    _In_ sqlite3_stmt* pragmaStmt
+)
+{
+    if (IsReusablePragmaStmt_(pragma) == true)
     {
-        return StmtType::kVacuum;
+        sqlite3_reset(pragmaStmt);
     }
     else
     {
-        return StmtType::kUnknown;
+        sqlite3_finalize(pragmaStmt);
     }
 }
 
-const std::string::traits_type::char_type* EzSqlite::SqliteManager::GetPreparedStmtString_(
-    _In_ sqlite3_stmt* stmt,
-    _In_opt_ bool withBoundParameters /*= false*/
+std::string EzSqlite::PragmaSetting::ToSqlLiteral(
+    _In_ double value
 )
 {
-    if (withBoundParameters == false)
+    char valueString[32] = { 0, };
+
+    sprintf_s(valueString, "%.17g", value);
+    return valueString;
+}
+
+std::string EzSqlite::PragmaSetting::ToSqlLiteral(
+    _In_ const std::string::traits_type::char_type* value
+)
+{
+    return ToSqlLiteral(StmtText(value, 0));
+}
+
+std::string EzSqlite::PragmaSetting::ToSqlLiteral(
+    _In_ const std::string& value
+)
+{
+    return ToSqlLiteral(StmtText(value.c_str(), static_cast<uint32_t>(value.size())));
+}
+
+std::string EzSqlite::PragmaSetting::ToSqlLiteral(
+    _In_ const StmtText& value
+)
+{
+    std::string literal;
+    size_t textLength = 0;
+
+    if (value.data == nullptr)
     {
-        return sqlite3_sql(stmt);
+        return "NULL";
     }
-    else
+
+    textLength = (value.byteSize == 0) ? std::string::traits_type::length(value.data) : value.byteSize;
+
+    literal.reserve(textLength + 2);
+    literal += '\'';
+    for (size_t textOffset = 0; textOffset < textLength; textOffset++)
     {
-        return sqlite3_expanded_sql(stmt);
+        if (value.data[textOffset] == '\'')
+        {
+            literal += '\'';
+        }
+        literal += value.data[textOffset];
     }
+    literal += '\'';
+
+    return literal;
 }
 
-void EzSqlite::SqliteManager::SetPragmaStmtInfo_(
-    _In_ const std::string& stmtString,
-    _Out_ StmtInfo& stmtInfo
+std::string EzSqlite::PragmaSetting::ToSqlLiteral(
+    _In_ const StmtBlob& value
 )
 {
-    stmtInfo.stmt = nullptr;
-    stmtInfo.stmtString = stmtString;
-    stmtInfo.stmtType = StmtType::kPragma;
-    stmtInfo.columnCount = 0;
-    stmtInfo.bindParameterCount = static_cast<uint32_t>(std::count(stmtString.begin(), stmtString.end(), '?'));
+    const char kHexDigitList[] = "0123456789ABCDEF";
+
+    std::string literal;
+    const uint8_t* blobData = static_cast<const uint8_t*>(value.data);
+
+    literal.reserve(value.byteSize * 2 + 3);
+    literal += "X'";
+    for (uint32_t blobOffset = 0; blobOffset < value.byteSize; blobOffset++)
+    {
+        literal += kHexDigitList[blobData[blobOffset] >> 4];
+        literal += kHexDigitList[blobData[blobOffset] & 0x0F];
+    }
+    literal += '\'';
+
+    return literal;
 }
 
-EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt_(
-    _In_ const StmtInfo stmtInfo,
+void EzSqlite::SqliteManager::SetBatchDataChangeNotificationCallback(
+    _In_opt_ FPBatchDataChangeNotificationCallback batchDataChangeNotificationCallback,
+    _In_opt_ void* batchDataChangeNotificationCallbackUserContext
+)
+{
+    batchDataChangeNotificationCallback_ = batchDataChangeNotificationCallback;
+    batchDataChangeNotificationCallbackUserContext_ = batchDataChangeNotificationCallbackUserContext;
+    ApplyDataChangeHook_();
+}
+
+void EzSqlite::SqliteManager::GetBusyOptions(
+    _Out_ BusyOptions& busyOptions
+)
+{
+    busyOptions = busyOptions_;
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::GetBusyWaitHistogram(
+    _In_ StmtHandle preparedStmtHandle,
+    _Out_ BusyWaitHistogram& busyWaitHistogram
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const StmtInfo* preparedStmtInfo = nullptr;
+
+    retValue = FindPreparedStmt(preparedStmtHandle, preparedStmtInfo);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    busyWaitHistogram = preparedStmtInfo->busyWaitHistogram;
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::SqliteManager::GetBusyWaitHistogram(
+    _Out_ BusyWaitHistogram& busyWaitHistogram
+)
+{
+    busyWaitHistogram = busyWaitHistogram_;
+}
+
+int EzSqlite::SqliteManager::GetLimit(
+    _In_ int limitId
+)
+{
+    if (database_ == nullptr)
+    {
+        return -1;
+    }
+
+    return sqlite3_limit(database_, limitId, -1);
+}
+
+int EzSqlite::SqliteManager::GetChanges()
+{
+    if (database_ == nullptr)
+    {
+        return 0;
+    }
+
+    return sqlite3_changes(database_);
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::BeginTransaction(
+    _In_opt_ bool immediate /*= true*/
+)
+{
+    if (immediate == true)
+    {
+        return this->ExecStmt(internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kBeginImmediate)]);
+    }
+    else
+    {
+        return this->ExecStmt(internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kBegin)]);
+    }
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::CommitTransaction()
+{
+    return this->ExecStmt(internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kCommit)]);
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::RollbackTransaction()
+{
+    return this->ExecStmt(internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kRollback)]);
+}
+
+bool EzSqlite::SqliteManager::IsInTransaction()
+{
+    if (database_ == nullptr)
+    {
+        return false;
+    }
+
+    // autocommit 모드가 아니면 트랜잭션이 열려있는 상태
+    return sqlite3_get_autocommit(database_) == 0;
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt(
+    _In_ StmtHandle preparedStmtHandle,
     _In_opt_ const std::vector<StmtBindParameterInfo>* stmtBindParameterInfoList /*= nullptr */,
     _In_opt_ StepCallbackFunc* stmtStepCallback /*= nullptr*/
 )
+{
+    if (stmtBindParameterInfoList == nullptr)
+    {
+        return ExecStmt(preparedStmtHandle, nullptr, 0, stmtStepCallback);
+    }
+
+    return ExecStmt(
+        preparedStmtHandle,
+        stmtBindParameterInfoList->data(),
+        static_cast<uint32_t>(stmtBindParameterInfoList->size()),
+        stmtStepCallback
+    );
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt(
+    _In_ StmtHandle preparedStmtHandle,
+    _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ uint32_t stmtBindParameterInfoCount,
+    _In_opt_ StepCallbackFunc* stmtStepCallback /*= nullptr*/
+)
 {
     Errors retValue = Errors::kUnsuccess;
 
-    std::string pragmaStmtString;
+    const StmtInfo* stmtInfo = nullptr;
 
-    int sqliteStatus = SQLITE_ERROR;
-    uint32_t stepCount = 0;
-    CallbackErrors callbackStatus;
+    if (database_ == nullptr)
+    {
+        return retValue;
+    }
+
+    retValue = FindPreparedStmt(preparedStmtHandle, stmtInfo);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    return ExecStmt_(*stmtInfo, stmtBindParameterInfoList, stmtBindParameterInfoCount, stmtStepCallback);
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::PrepareInternalStmt_()
+{
+    Errors retValue = Errors::kUnsuccess;
 
     auto raii = RAIIRegister([&]
         {
-            sqlite3_clear_bindings(stmtInfo.stmt);
-            sqlite3_reset(stmtInfo.stmt);
-            if (stmtInfo.stmtType == StmtType::kPragma)
+            if (retValue != Errors::kSuccess)
             {
-                sqlite3_finalize(stmtInfo.stmt);
+                this->ClearPreparedStmt();
             }
         });
 
-    // Bind Parameter
-    if (stmtInfo.bindParameterCount != 0)
+    retValue = this->PrepareStmt("BEGIN;", SQLITE_PREPARE_PERSISTENT, &internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kBegin)]);
+    if (retValue != Errors::kSuccess)
     {
-        if (stmtBindParameterInfoList == nullptr)
-        {
-            return retValue;
-        }
-        else if (stmtInfo.bindParameterCount != stmtBindParameterInfoList->size())
-        {
-            return retValue;
-        }
-
-        if (stmtInfo.stmtType != StmtType::kPragma)
-        {
-            retValue = StmtBindParameter_(stmtInfo, *stmtBindParameterInfoList);
-            if (retValue != Errors::kSuccess)
-            {
-                return retValue;
-            }
-        }
-        else
-        {
-            retValue = PragmaStmtBindParameter_(stmtInfo, *stmtBindParameterInfoList, pragmaStmtString);
-            if (retValue != Errors::kSuccess)
-            {
-                return retValue;
-            }
-        }
+        return retValue;
     }
 
-    if (stmtInfo.stmtType == StmtType::kPragma)
+    retValue = this->PrepareStmt("BEGIN IMMEDIATE;", SQLITE_PREPARE_PERSISTENT, &internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kBeginImmediate)]);
+    if (retValue != Errors::kSuccess)
     {
-        sqliteStatus = SqlitePrepareV3_(
-            database_,
-            pragmaStmtString.length() == 0 ? stmtInfo.stmtString.c_str() : pragmaStmtString.c_str(),
-            -1,
-            SQLITE_PREPARE_PERSISTENT,
-            &stmtInfo.stmt,
-            nullptr
-        );
-        if (sqliteStatus != SQLITE_OK)
-        {
-            return retValue;
-        }
+        return retValue;
     }
 
-    sqliteStatus = SqliteStep_(stmtInfo.stmt);
-    stepCount++;
-
-    do
+    retValue = this->PrepareStmt("COMMIT;", SQLITE_PREPARE_PERSISTENT, &internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kCommit)]);
+    if (retValue != Errors::kSuccess)
     {
-        if (sqliteStatus == SQLITE_ROW)
-        {
-            if (stmtStepCallback != nullptr)
-            {
-                callbackStatus = (*stmtStepCallback)(stmtInfo);
-                if (callbackStatus == CallbackErrors::kStop)
-                {
-                    retValue = Errors::kStopCallback;
-                    break;
-                }
-                else if (callbackStatus == CallbackErrors::kFail)
-                {
-                    retValue = Errors::kFailCallback;
-                    break;
-                }
-            }
-        }
-        else if (sqliteStatus == SQLITE_DONE)
-        {
-            if ((stmtInfo.stmtType == StmtType::kSelect) && (stepCount == 1))
-            {
-                retValue = Errors::kNoResult;
-            }
-            else
-            {
-                retValue = Errors::kSuccess;
-            }
-
-            break;
-        }
-        else
-        {
-            retValue = Errors::kUnsuccess;
-            break;
-        }
+        return retValue;
+    }
 
-        sqliteStatus = SqliteStep_(stmtInfo.stmt);
-        stepCount++;
+    retValue = this->PrepareStmt("ROLLBACK;", SQLITE_PREPARE_PERSISTENT, &internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kRollback)]);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
 
-    } while (true);
+    retValue = this->PrepareStmt("VACUUM;", SQLITE_PREPARE_PERSISTENT, &internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kVacuum)]);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
 
+    retValue = Errors::kSuccess;
     return retValue;
 }
 
-EzSqlite::Errors EzSqlite::SqliteManager::StmtBindParameter_(
-    _In_ const StmtInfo& stmtInfo,
-    _In_ const std::vector<StmtBindParameterInfo>& stmtBindParameterInfoList
+EzSqlite::Errors EzSqlite::SqliteManager::AcquireCachedStmt_(
+    _In_ const std::string& stmtString,
+    _Out_ StmtCacheEntry*& stmtCacheEntry
 )
 {
-    Errors retValue = Errors::kUnsuccess;
+    Errors retValue = Errors::kNotFound;
 
     int sqliteStatus = SQLITE_ERROR;
 
-    /*
-          SQL Parameter Index 1
-    */
-    uint32_t parameterIndex = 1;
+    uint64_t stmtStringHash = 0;
+    StmtCacheEntry newStmtCacheEntry;
 
-    for (const auto& stmtBindParameterInfoListEntry : stmtBindParameterInfoList)
+    if (stmtCacheSize_ == 0)
     {
-        switch (stmtBindParameterInfoListEntry.dataType)
-        {
-        case StmtDataType::kInteger:
-            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int8_t))
+        return retValue;
+    }
+
+    stmtStringHash = GetStmtStringHash_(stmtString.c_str(), stmtString.length());
+
+    auto stmtCacheIndexRange = stmtCacheIndexMap_.equal_range(stmtStringHash);
+    for (auto stmtCacheIndexEntry = stmtCacheIndexRange.first; stmtCacheIndexEntry != stmtCacheIndexRange.second; ++stmtCacheIndexEntry)
+    {
+        if (stmtCacheIndexEntry->second->stmtString != stmtString)
+        {
+            continue;
+        }
+
+        // StepCallback 안에서 같은 명령문을 다시 실행하는 경우 캐시된 Statement는 사용 중이므로 별도로 Prepare
+        if (stmtCacheIndexEntry->second->inUse == true)
+        {
+            stmtCacheStatistics_.missCount++;
+            return retValue;
+        }
+
+        // 가장 최근에 사용된 항목이 앞에 위치
+        stmtCacheList_.splice(stmtCacheList_.begin(), stmtCacheList_, stmtCacheIndexEntry->second);
+        stmtCacheEntry = &(*stmtCacheIndexEntry->second);
+        stmtCacheEntry->inUse = true;
+        stmtCacheStatistics_.hitCount++;
+
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    stmtCacheStatistics_.missCount++;
+
+    sqliteStatus = SqlitePrepareV3_(
+        database_,
+        stmtString.c_str(),
+        -1,
+        SQLITE_PREPARE_PERSISTENT,
+        &newStmtCacheEntry.stmtInfo.stmt,
+        nullptr
+    );
+    if (sqliteStatus != SQLITE_OK)
+    {
+        retValue = Errors::kUnsuccess;
+        return retValue;
+    }
+
+    GetStmtInfo_(newStmtCacheEntry.stmtInfo);
+    newStmtCacheEntry.stmtString = stmtString;
+    newStmtCacheEntry.stmtStringHash = stmtStringHash;
+    newStmtCacheEntry.inUse = true;
+
+    stmtCacheList_.push_front(newStmtCacheEntry);
+    stmtCacheIndexMap_.emplace(stmtStringHash, stmtCacheList_.begin());
+    stmtCacheEntry = &stmtCacheList_.front();
+
+    TrimStmtCache_();
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::SqliteManager::TrimStmtCache_()
+{
+    auto stmtCacheListEntry = stmtCacheList_.end();
+
+    while ((stmtCacheList_.size() > stmtCacheSize_) && (stmtCacheListEntry != stmtCacheList_.begin()))
+    {
+        --stmtCacheListEntry;
+
+        // 실행 중인 Statement는 제거하지 않고 다음 Trim 시점으로 미룸
+        if (stmtCacheListEntry->inUse == true)
+        {
+            continue;
+        }
+
+        auto stmtCacheIndexRange = stmtCacheIndexMap_.equal_range(stmtCacheListEntry->stmtStringHash);
+        for (auto stmtCacheIndexEntry = stmtCacheIndexRange.first; stmtCacheIndexEntry != stmtCacheIndexRange.second; ++stmtCacheIndexEntry)
+        {
+            if (stmtCacheIndexEntry->second == stmtCacheListEntry)
             {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    sqliteStatus = sqlite3_bind_int(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const int8_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    sqliteStatus = sqlite3_bind_int(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const uint8_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
+                stmtCacheIndexMap_.erase(stmtCacheIndexEntry);
+                break;
             }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int16_t))
+        }
+
+        sqlite3_finalize(stmtCacheListEntry->stmtInfo.stmt);
+        stmtCacheListEntry = stmtCacheList_.erase(stmtCacheListEntry);
+        stmtCacheStatistics_.evictionCount++;
+    }
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::AcquirePreparedStmt_(
+    _In_ const std::string& stmtString,
+    _Out_ const StmtInfo*& stmtInfo
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    retValue = FindPreparedStmt(stmtString, stmtInfo);
+    if (retValue == Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    retValue = PrepareStmt(stmtString);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    return FindPreparedStmt(stmtString, stmtInfo);
+}
+
+void EzSqlite::SqliteManager::GetStmtInfo_(
+    _Inout_ StmtInfo& stmtInfo
+)
+{
+    if (stmtInfo.stmt == nullptr)
+    {
+        return;
+    }
+
+    stmtInfo.stmtString.assign(GetPreparedStmtString_(stmtInfo.stmt));
+    stmtInfo.stmtStringHash = GetStmtStringHash_(stmtInfo.stmtString.c_str(), stmtInfo.stmtString.length());
+    stmtInfo.stmtType = GetStmtType_(stmtInfo.stmtString.c_str());
+    stmtInfo.columnCount = sqlite3_column_count(stmtInfo.stmt);
+    stmtInfo.bindParameterCount = sqlite3_bind_parameter_count(stmtInfo.stmt);
+
+    return;
+}
+
+EzSqlite::StmtType EzSqlite::SqliteManager::GetStmtType_(
+    _In_ const std::string::traits_type::char_type* stmtString
+)
+{
+    // 첫 키워드의 첫 글자로 분기하고 길이가 같은 후보만 비교 (앞의 공백, 주석은 건너뜀)
+    uint32_t keywordLength = 0;
+    const std::string::traits_type::char_type* keyword = SkipStmtSpace_(stmtString);
+    const std::string::traits_type::char_type* nextStmtString = ReadStmtKeyword_(keyword, keywordLength);
+
+    uint32_t nextKeywordLength = 0;
+    const std::string::traits_type::char_type* nextKeyword = nullptr;
+
+    if (keywordLength == 0)
+    {
+        return StmtType::kUnknown;
+    }
+
+    switch (keyword[0] & ~0x20)
+    {
+    case 'A':
+        if (IsStmtKeyword_(keyword, keywordLength, "ALTER"))
+        {
+            nextKeyword = SkipStmtSpace_(nextStmtString);
+            ReadStmtKeyword_(nextKeyword, nextKeywordLength);
+            if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TABLE"))
             {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    sqliteStatus = sqlite3_bind_int(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const int16_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    sqliteStatus = sqlite3_bind_int(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const uint16_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
+                return StmtType::kAlterTable;
             }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int32_t))
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "ANALYZE"))
+        {
+            return StmtType::kAnalyze;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "ATTACH"))
+        {
+            return StmtType::kAttach;
+        }
+        break;
+
+    case 'B':
+        if (IsStmtKeyword_(keyword, keywordLength, "BEGIN"))
+        {
+            return StmtType::kBegin;
+        }
+        break;
+
+    case 'C':
+        if (IsStmtKeyword_(keyword, keywordLength, "COMMIT"))
+        {
+            return StmtType::kCommit;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "CREATE"))
+        {
+            // CREATE [TEMP | TEMPORARY] [UNIQUE] INDEX | TABLE | TRIGGER | VIEW, CREATE VIRTUAL TABLE
+            do
             {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    sqliteStatus = sqlite3_bind_int(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const int32_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    sqliteStatus = sqlite3_bind_int(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const uint32_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
+                nextKeyword = SkipStmtSpace_(nextStmtString);
+                nextStmtString = ReadStmtKeyword_(nextKeyword, nextKeywordLength);
+            } while (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TEMP") ||
+                IsStmtKeyword_(nextKeyword, nextKeywordLength, "TEMPORARY") ||
+                IsStmtKeyword_(nextKeyword, nextKeywordLength, "UNIQUE"));
+
+            if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "INDEX"))
+            {
+                return StmtType::kCreateIndex;
             }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int64_t))
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TABLE"))
             {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    sqliteStatus = sqlite3_bind_int64(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const int64_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    sqliteStatus = sqlite3_bind_int64(
-                        stmtInfo.stmt,
-                        parameterIndex++,
-                        *reinterpret_cast<const uint64_t*>(stmtBindParameterInfoListEntry.data)
-                    );
-                }
+                return StmtType::kCreateTable;
             }
-            break;
-
-        case StmtDataType::kFloat:
-            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(float_t))
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TRIGGER"))
             {
-                sqliteStatus = sqlite3_bind_double(
-                    stmtInfo.stmt,
-                    parameterIndex++,
-                    *reinterpret_cast<const float_t*>(stmtBindParameterInfoListEntry.data)
-                );
+                return StmtType::kCreateTrigger;
             }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(double_t))
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "VIEW"))
             {
-                sqliteStatus = sqlite3_bind_double(
-                    stmtInfo.stmt,
-                    parameterIndex++,
-                    *reinterpret_cast<const double_t*>(stmtBindParameterInfoListEntry.data)
-                );
+                return StmtType::kCreateView;
             }
-            break;
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "VIRTUAL"))
+            {
+                nextKeyword = SkipStmtSpace_(nextStmtString);
+                ReadStmtKeyword_(nextKeyword, nextKeywordLength);
+                if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TABLE"))
+                {
+                    return StmtType::kCreateVirtualTable;
+                }
+            }
+        }
+        break;
 
-        case StmtDataType::kText:
-            if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorStatic)
+    case 'D':
+        if (IsStmtKeyword_(keyword, keywordLength, "DELETE"))
+        {
+            return StmtType::kDelete;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "DETACH"))
+        {
+            return StmtType::kDetach;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "DROP"))
+        {
+            nextKeyword = SkipStmtSpace_(nextStmtString);
+            ReadStmtKeyword_(nextKeyword, nextKeywordLength);
+            if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "INDEX"))
             {
-                sqliteStatus = sqlite3_bind_text(
-                    stmtInfo.stmt,
-                    parameterIndex++,
-                    reinterpret_cast<const std::string::traits_type::char_type*>(stmtBindParameterInfoListEntry.data),
-                    stmtBindParameterInfoListEntry.dataByteSize == 0 ? -1 : stmtBindParameterInfoListEntry.dataByteSize,
-                    SQLITE_STATIC
-                );
+                return StmtType::kDropIndex;
             }
-            else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kNone ||
-                stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorTransient)
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TABLE"))
             {
-                sqliteStatus = sqlite3_bind_text(
-                    stmtInfo.stmt,
-                    parameterIndex++,
-                    reinterpret_cast<const std::string::traits_type::char_type*>(stmtBindParameterInfoListEntry.data),
-                    stmtBindParameterInfoListEntry.dataByteSize == 0 ? -1 : stmtBindParameterInfoListEntry.dataByteSize,
-                    SQLITE_TRANSIENT
-                );
+                return StmtType::kDropTable;
             }
-            break;
-
-        case StmtDataType::kBlob:
-            if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorStatic)
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "TRIGGER"))
             {
-                sqliteStatus = sqlite3_bind_blob(
-                    stmtInfo.stmt,
-                    parameterIndex++,
-                    stmtBindParameterInfoListEntry.data,
-                    stmtBindParameterInfoListEntry.dataByteSize,
-                    SQLITE_STATIC
-                );
+                return StmtType::kDropTrigger;
             }
-            else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kNone ||
-                stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorTransient)
+            else if (IsStmtKeyword_(nextKeyword, nextKeywordLength, "VIEW"))
             {
-                sqliteStatus = sqlite3_bind_blob(
-                    stmtInfo.stmt,
-                    parameterIndex++,
-                    stmtBindParameterInfoListEntry.data,
-                    stmtBindParameterInfoListEntry.dataByteSize,
-                    SQLITE_TRANSIENT
-                );
+                return StmtType::kDropView;
             }
-            break;
+        }
+        break;
 
-        case StmtDataType::kNull:
-            sqliteStatus = sqlite3_bind_null(
-                stmtInfo.stmt,
-                parameterIndex++
-            );
-            break;
+    case 'E':
+        // END [TRANSACTION]은 COMMIT과 같음
+        if (IsStmtKeyword_(keyword, keywordLength, "END"))
+        {
+            return StmtType::kCommit;
+        }
+        break;
+
+    case 'I':
+        // INSERT OR IGNORE 등도 포함
+        if (IsStmtKeyword_(keyword, keywordLength, "INSERT"))
+        {
+            return StmtType::kInsert;
+        }
+        break;
+
+    case 'P':
+        if (IsStmtKeyword_(keyword, keywordLength, "PRAGMA"))
+        {
+            return StmtType::kPragma;
+        }
+        break;
+
+    case 'R':
+        if (IsStmtKeyword_(keyword, keywordLength, "REINDEX"))
+        {
+            return StmtType::kReindex;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "RELEASE"))
+        {
+            return StmtType::kRelease;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "REPLACE"))
+        {
+            // REPLACE INTO는 INSERT OR REPLACE INTO와 같음
+            return StmtType::kInsert;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "ROLLBACK"))
+        {
+            return StmtType::kRollback;
+        }
+        break;
+
+    case 'S':
+        if (IsStmtKeyword_(keyword, keywordLength, "SAVEPOINT"))
+        {
+            return StmtType::kSavepoint;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "SELECT"))
+        {
+            return StmtType::kSelect;
+        }
+        break;
+
+    case 'U':
+        if (IsStmtKeyword_(keyword, keywordLength, "UPDATE"))
+        {
+            return StmtType::kUpdate;
+        }
+        break;
+
+    case 'V':
+        if (IsStmtKeyword_(keyword, keywordLength, "VACUUM"))
+        {
+            return StmtType::kVacuum;
+        }
+        else if (IsStmtKeyword_(keyword, keywordLength, "VALUES"))
+        {
+            return StmtType::kSelect;
+        }
+        break;
+
+    case 'W':
+        if (IsStmtKeyword_(keyword, keywordLength, "WITH"))
+        {
+            return GetWithStmtType_(nextStmtString);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return StmtType::kUnknown;
+}
+
+EzSqlite::StmtType EzSqlite::SqliteManager::GetWithStmtType_(
+    _In_ const std::string::traits_type::char_type* stmtString
+)
+{
+    // WITH [RECURSIVE] name [(column, ...)] AS [[NOT] MATERIALIZED] (...) [, ...] 다음에 오는 본문의 첫 키워드로 판단
+    // 괄호 안(CTE 정의)과 문자열, 식별자 인용은 건너뜀
+    uint32_t parenthesisDepth = 0;
+    uint32_t keywordLength = 0;
+    const std::string::traits_type::char_type* keyword = nullptr;
+    std::string::traits_type::char_type quoteCharacter = 0;
+
+    for (stmtString = SkipStmtSpace_(stmtString); *stmtString != 0; stmtString = SkipStmtSpace_(stmtString))
+    {
+        switch (*stmtString)
+        {
+        case '(':
+            parenthesisDepth++;
+            stmtString++;
+            break;
+
+        case ')':
+            if (parenthesisDepth == 0)
+            {
+                return StmtType::kUnknown;
+            }
+            parenthesisDepth--;
+            stmtString++;
+            break;
+
+        case '\'':
+        case '"':
+        case '`':
+        case '[':
+            // 닫는 문자가 두 번 연속되면 escape이므로 인용이 다시 시작된 것으로 처리해도 결과는 같음
+            quoteCharacter = (*stmtString == '[') ? ']' : *stmtString;
+            for (stmtString++; (*stmtString != 0) && (*stmtString != quoteCharacter); stmtString++)
+            {
+            }
+            if (*stmtString != 0)
+            {
+                stmtString++;
+            }
+            break;
+
+        default:
+            keyword = stmtString;
+            stmtString = ReadStmtKeyword_(keyword, keywordLength);
+            if (keywordLength == 0)
+            {
+                stmtString++;
+            }
+            else if (parenthesisDepth == 0)
+            {
+                if (IsStmtKeyword_(keyword, keywordLength, "SELECT") || IsStmtKeyword_(keyword, keywordLength, "VALUES"))
+                {
+                    return StmtType::kSelect;
+                }
+                else if (IsStmtKeyword_(keyword, keywordLength, "INSERT") || IsStmtKeyword_(keyword, keywordLength, "REPLACE"))
+                {
+                    return StmtType::kInsert;
+                }
+                else if (IsStmtKeyword_(keyword, keywordLength, "UPDATE"))
+                {
+                    return StmtType::kUpdate;
+                }
+                else if (IsStmtKeyword_(keyword, keywordLength, "DELETE"))
+                {
+                    return StmtType::kDelete;
+                }
+            }
+            break;
+        }
+    }
+
+    return StmtType::kUnknown;
+}
+
+const std::string::traits_type::char_type* EzSqlite::SqliteManager::SkipStmtSpace_(
+    _In_ const std::string::traits_type::char_type* stmtString
+)
+{
+    for (;;)
+    {
+        if ((*stmtString == ' ') || (*stmtString == '\t') || (*stmtString == '\r') || (*stmtString == '\n') || (*stmtString == '\f') || (*stmtString == '\v'))
+        {
+            stmtString++;
+        }
+        else if ((stmtString[0] == '-') && (stmtString[1] == '-'))
+        {
+            for (stmtString += 2; (*stmtString != 0) && (*stmtString != '\n'); stmtString++)
+            {
+            }
+        }
+        else if ((stmtString[0] == '/') && (stmtString[1] == '*'))
+        {
+            // 닫히지 않은 주석은 문장 끝까지
+            for (stmtString += 2; (*stmtString != 0) && !((stmtString[0] == '*') && (stmtString[1] == '/')); stmtString++)
+            {
+            }
+            if (*stmtString != 0)
+            {
+                stmtString += 2;
+            }
+        }
+        else
+        {
+            return stmtString;
+        }
+    }
+}
+
+const std::string::traits_type::char_type* EzSqlite::SqliteManager::ReadStmtKeyword_(
+    _In_ const std::string::traits_type::char_type* stmtString,
+    _Out_ uint32_t& keywordLength
+)
+{
+    keywordLength = 0;
+
+    while (((stmtString[keywordLength] >= 'A') && (stmtString[keywordLength] <= 'Z')) ||
+        ((stmtString[keywordLength] >= 'a') && (stmtString[keywordLength] <= 'z')) ||
+        ((stmtString[keywordLength] >= '0') && (stmtString[keywordLength] <= '9')) ||
+        (stmtString[keywordLength] == '_'))
+    {
+        keywordLength++;
+    }
+
+    return stmtString + keywordLength;
+}
+
+bool EzSqlite::SqliteManager::IsStmtKeyword_(
+    _In_ const std::string::traits_type::char_type* keyword,
+    _In_ uint32_t keywordLength,
+    _In_ const char* expectedKeyword
+)
+{
+    // expectedKeyword는 대문자, keyword는 영문자, 숫자, _로만 구성되므로 0x20 비트를 지우면 대소문자 구분 없이 비교됨
+    // (숫자와 _는 대문자 영문자와 겹치지 않음)
+    uint32_t keywordOffset = 0;
+
+    for (keywordOffset = 0; keywordOffset < keywordLength; keywordOffset++)
+    {
+        if ((expectedKeyword[keywordOffset] == 0) || ((keyword[keywordOffset] & ~0x20) != expectedKeyword[keywordOffset]))
+        {
+            return false;
+        }
+    }
+
+    return expectedKeyword[keywordOffset] == 0;
+}
+
+uint64_t EzSqlite::SqliteManager::GetStmtStringHash_(
+    _In_ const std::string::traits_type::char_type* stmtString,
+    _In_ size_t stmtStringLength
+)
+{
+    // FNV-1a 64bit
+    const uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+    const uint64_t kFnvPrime = 1099511628211ULL;
+
+    uint64_t stmtStringHash = kFnvOffsetBasis;
+
+    for (size_t stmtStringOffset = 0; stmtStringOffset < stmtStringLength; stmtStringOffset++)
+    {
+        stmtStringHash ^= static_cast<uint8_t>(stmtString[stmtStringOffset]);
+        stmtStringHash *= kFnvPrime;
+    }
+
+    return stmtStringHash;
+}
+
+const std::string::traits_type::char_type* EzSqlite::SqliteManager::GetPreparedStmtString_(
+    _In_ sqlite3_stmt* stmt,
+    _In_opt_ bool withBoundParameters /*= false*/
+)
+{
+    if (withBoundParameters == false)
+    {
+        return sqlite3_sql(stmt);
+    }
+    else
+    {
+        return sqlite3_expanded_sql(stmt);
+    }
+}
+
+void EzSqlite::SqliteManager::SetPragmaStmtInfo_(
+    _In_ const std::string& stmtString,
+    _Out_ StmtInfo& stmtInfo
+)
+{
+    stmtInfo.stmt = nullptr;
+    stmtInfo.stmtString = stmtString;
+    stmtInfo.stmtStringHash = GetStmtStringHash_(stmtString.c_str(), stmtString.length());
+    stmtInfo.stmtType = StmtType::kPragma;
+    stmtInfo.columnCount = 0;
+    stmtInfo.bindParameterCount = static_cast<uint32_t>(std::count(stmtString.begin(), stmtString.end(), '?'));
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::ExecStmt_(
+    _In_ const StmtInfo& stmtInfo,
+    _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ uint32_t stmtBindParameterInfoCount,
+    _In_opt_ StepCallbackFunc* stmtStepCallback
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    std::string pragmaStmtString;
+
+    int sqliteStatus = SQLITE_ERROR;
+
+    auto raii = RAIIRegister([&]
+        {
+            // Pragma 명령문은 Prepare에 실패하면 stmt가 nullptr
+            if (stmtInfo.stmt == nullptr)
+            {
+                return;
+            }
+
+            sqlite3_clear_bindings(stmtInfo.stmt);
+            sqlite3_reset(stmtInfo.stmt);
+            if (stmtInfo.stmtType == StmtType::kPragma)
+            {
+                sqlite3_finalize(stmtInfo.stmt);
+                stmtInfo.stmt = nullptr;
+            }
+        });
+
+    // Bind Parameter
+    if (stmtInfo.bindParameterCount != 0)
+    {
+        if (stmtBindParameterInfoList == nullptr)
+        {
+            return retValue;
+        }
+        else if (stmtInfo.bindParameterCount != stmtBindParameterInfoCount)
+        {
+            return retValue;
+        }
+
+        if (stmtInfo.stmtType != StmtType::kPragma)
+        {
+            retValue = StmtBindParameter_(stmtInfo, stmtBindParameterInfoList, stmtBindParameterInfoCount);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+        }
+        else
+        {
+            retValue = PragmaStmtBindParameter_(stmtInfo, stmtBindParameterInfoList, stmtBindParameterInfoCount, pragmaStmtString);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+        }
+    }
+
+    if (stmtInfo.stmtType == StmtType::kPragma)
+    {
+        sqliteStatus = SqlitePrepareV3_(
+            database_,
+            pragmaStmtString.length() == 0 ? stmtInfo.stmtString.c_str() : pragmaStmtString.c_str(),
+            -1,
+            SQLITE_PREPARE_PERSISTENT,
+            &stmtInfo.stmt,
+            nullptr
+        );
+        if (sqliteStatus != SQLITE_OK)
+        {
+            // Bind 단계에서 retValue가 kSuccess로 바뀌었을 수 있음
+            retValue = Errors::kUnsuccess;
+            return retValue;
+        }
+    }
+
+    return StepStmt_(stmtInfo, stmtStepCallback);
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::StmtBindParameter_(
+    _In_ const StmtInfo& stmtInfo,
+    _In_reads_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ uint32_t stmtBindParameterInfoCount
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int sqliteStatus = SQLITE_ERROR;
+
+    /*
+        가장 왼쪽의 SQL Parameter Index는 1
+    */
+    uint32_t parameterIndex = 1;
+
+    for (uint32_t stmtBindParameterInfoIndex = 0; stmtBindParameterInfoIndex < stmtBindParameterInfoCount; stmtBindParameterInfoIndex++)
+    {
+        const StmtBindParameterInfo& stmtBindParameterInfoListEntry = stmtBindParameterInfoList[stmtBindParameterInfoIndex];
+
+        switch (stmtBindParameterInfoListEntry.dataType)
+        {
+        case StmtDataType::kInteger:
+            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int8_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    sqliteStatus = sqlite3_bind_int(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const int8_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    sqliteStatus = sqlite3_bind_int(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const uint8_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int16_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    sqliteStatus = sqlite3_bind_int(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const int16_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    sqliteStatus = sqlite3_bind_int(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const uint16_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int32_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    sqliteStatus = sqlite3_bind_int(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const int32_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    sqliteStatus = sqlite3_bind_int(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const uint32_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int64_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    sqliteStatus = sqlite3_bind_int64(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const int64_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    sqliteStatus = sqlite3_bind_int64(
+                        stmtInfo.stmt,
+                        parameterIndex++,
+                        *reinterpret_cast<const uint64_t*>(stmtBindParameterInfoListEntry.data)
+                    );
+                }
+            }
+            break;
+
+        case StmtDataType::kFloat:
+            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(float_t))
+            {
+                sqliteStatus = sqlite3_bind_double(
+                    stmtInfo.stmt,
+                    parameterIndex++,
+                    *reinterpret_cast<const float_t*>(stmtBindParameterInfoListEntry.data)
+                );
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(double_t))
+            {
+                sqliteStatus = sqlite3_bind_double(
+                    stmtInfo.stmt,
+                    parameterIndex++,
+                    *reinterpret_cast<const double_t*>(stmtBindParameterInfoListEntry.data)
+                );
+            }
+            break;
+
+        case StmtDataType::kText:
+            if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorStatic)
+            {
+                sqliteStatus = sqlite3_bind_text(
+                    stmtInfo.stmt,
+                    parameterIndex++,
+                    reinterpret_cast<const std::string::traits_type::char_type*>(stmtBindParameterInfoListEntry.data),
+                    stmtBindParameterInfoListEntry.dataByteSize == 0 ? -1 : stmtBindParameterInfoListEntry.dataByteSize,
+                    SQLITE_STATIC
+                );
+            }
+            else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kNone ||
+                stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorTransient)
+            {
+                sqliteStatus = sqlite3_bind_text(
+                    stmtInfo.stmt,
+                    parameterIndex++,
+                    reinterpret_cast<const std::string::traits_type::char_type*>(stmtBindParameterInfoListEntry.data),
+                    stmtBindParameterInfoListEntry.dataByteSize == 0 ? -1 : stmtBindParameterInfoListEntry.dataByteSize,
+                    SQLITE_TRANSIENT
+                );
+            }
+            break;
+
+        case StmtDataType::kBlob:
+            if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorStatic)
+            {
+                sqliteStatus = sqlite3_bind_blob(
+                    stmtInfo.stmt,
+                    parameterIndex++,
+                    stmtBindParameterInfoListEntry.data,
+                    stmtBindParameterInfoListEntry.dataByteSize,
+                    SQLITE_STATIC
+                );
+            }
+            else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kNone ||
+                stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kDestructorTransient)
+            {
+                sqliteStatus = sqlite3_bind_blob(
+                    stmtInfo.stmt,
+                    parameterIndex++,
+                    stmtBindParameterInfoListEntry.data,
+                    stmtBindParameterInfoListEntry.dataByteSize,
+                    SQLITE_TRANSIENT
+                );
+            }
+            break;
+
+        case StmtDataType::kNull:
+            sqliteStatus = sqlite3_bind_null(
+                stmtInfo.stmt,
+                parameterIndex++
+            );
+            break;
+        }
+
+        if (sqliteStatus != SQLITE_OK)
+        {
+            return retValue;
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::PragmaStmtBindParameter_(
+    _In_ const StmtInfo& stmtInfo,
+    _In_reads_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ uint32_t stmtBindParameterInfoCount,
+    _Out_ std::string& pragmaStmtString
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    size_t pragmaStmtStringOffset = 0;
+
+    auto raii = RAIIRegister([&]
+        {
+            if ((retValue != Errors::kSuccess) && (pragmaStmtString.length() != 0))
+            {
+                pragmaStmtString.clear();
+            }
+        });
+
+    pragmaStmtString = stmtInfo.stmtString;
+
+    for (uint32_t stmtBindParameterInfoIndex = 0; stmtBindParameterInfoIndex < stmtBindParameterInfoCount; stmtBindParameterInfoIndex++)
+    {
+        const StmtBindParameterInfo& stmtBindParameterInfoListEntry = stmtBindParameterInfoList[stmtBindParameterInfoIndex];
+
+        pragmaStmtStringOffset = pragmaStmtString.find_first_of('?', pragmaStmtStringOffset);
+        pragmaStmtString.erase(pragmaStmtStringOffset, 1);
+
+        switch (stmtBindParameterInfoListEntry.dataType)
+        {
+        case StmtDataType::kInteger:
+            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int8_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int8_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint8_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int16_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int16_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint16_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int32_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int32_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint32_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int64_t))
+            {
+                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int64_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
+                {
+                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint64_t*>(stmtBindParameterInfoListEntry.data)));
+                }
+            }
+            break;
+        case StmtDataType::kFloat:
+            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(float_t))
+            {
+                pragmaStmtString.insert(pragmaStmtStringOffset, PragmaSetting::ToSqlLiteral(*reinterpret_cast<const float_t*>(stmtBindParameterInfoListEntry.data)));
+            }
+            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(double_t))
+            {
+                pragmaStmtString.insert(pragmaStmtStringOffset, PragmaSetting::ToSqlLiteral(*reinterpret_cast<const double_t*>(stmtBindParameterInfoListEntry.data)));
+            }
+            else
+            {
+                return retValue;
+            }
+            break;
+        case StmtDataType::kText:
+            pragmaStmtString.insert(
+                pragmaStmtStringOffset,
+                PragmaSetting::ToSqlLiteral(StmtText(
+                    static_cast<const std::string::traits_type::char_type*>(stmtBindParameterInfoListEntry.data),
+                    (stmtBindParameterInfoListEntry.dataByteSize == static_cast<uint32_t>(-1)) ? 0 : stmtBindParameterInfoListEntry.dataByteSize
+                ))
+            );
+            break;
+        case StmtDataType::kBlob:
+            pragmaStmtString.insert(
+                pragmaStmtStringOffset,
+                PragmaSetting::ToSqlLiteral(StmtBlob(stmtBindParameterInfoListEntry.data, stmtBindParameterInfoListEntry.dataByteSize))
+            );
+            break;
+        case StmtDataType::kNull:
+            return retValue;
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+void EzSqlite::SqliteManager::ClearSchemaFingerprintCache()
+{
+    SchemaFingerprintCache& schemaFingerprintCache = GetSchemaFingerprintCache_();
+
+    std::lock_guard<std::mutex> lock(schemaFingerprintCache.mutex);
+    schemaFingerprintCache.schemaFingerprintMap.clear();
+}
+
+void EzSqlite::SqliteManager::GetSchemaVerifyStatistics(
+    _Out_ SchemaVerifyStatistics& schemaVerifyStatistics
+)
+{
+    SchemaFingerprintCache& schemaFingerprintCache = GetSchemaFingerprintCache_();
+
+    std::lock_guard<std::mutex> lock(schemaFingerprintCache.mutex);
+    schemaVerifyStatistics = schemaFingerprintCache.schemaVerifyStatistics;
+}
+
+EzSqlite::StmtType EzSqlite::SqliteManager::GetStmtType(
+    _In_ const std::string::traits_type::char_type* stmtString
+)
+{
+    return GetStmtType_(stmtString);
+}
+
+uint64_t EzSqlite::SqliteManager::GetStmtStringHash(
+    _In_ const std::string& stmtString
+)
+{
+    return GetStmtStringHash_(stmtString.c_str(), stmtString.length());
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::VerifyTableWithCache_(
+    _In_ const std::wstring& databasePath,
+    _In_ const std::vector<std::string>& verifyTableStmtStringList
+)
+{
+    Errors retValue = Errors::kFailedVerifyTable;
+
+    SchemaFingerprintCache& schemaFingerprintCache = GetSchemaFingerprintCache_();
+    SchemaFingerprint schemaFingerprint;
+    bool validSchemaFingerprint = false;
+    uint32_t verifyPrepareCount = 0;
+
+    if (verifyTableStmtStringList.size() == 0)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    // 상태를 읽을 수 없으면 캐시 없이 검증
+    if (GetSchemaFingerprint_(verifyTableStmtStringList, schemaFingerprint) == Errors::kSuccess)
+    {
+        validSchemaFingerprint = true;
+
+        std::lock_guard<std::mutex> lock(schemaFingerprintCache.mutex);
+
+        auto schemaFingerprintIterator = schemaFingerprintCache.schemaFingerprintMap.find(databasePath);
+        if ((schemaFingerprintIterator != schemaFingerprintCache.schemaFingerprintMap.end()) &&
+            (schemaFingerprintIterator->second == schemaFingerprint))
+        {
+            schemaFingerprintCache.schemaVerifyStatistics.verifyCount++;
+            schemaFingerprintCache.schemaVerifyStatistics.cacheHitCount++;
+
+            retValue = Errors::kSuccess;
+            return retValue;
+        }
+    }
+
+    retValue = VerifyTable_(verifyTableStmtStringList, verifyPrepareCount);
+
+    std::lock_guard<std::mutex> lock(schemaFingerprintCache.mutex);
+    schemaFingerprintCache.schemaVerifyStatistics.verifyCount++;
+    schemaFingerprintCache.schemaVerifyStatistics.verifyPrepareCount += verifyPrepareCount;
+
+    if ((retValue == Errors::kSuccess) && (validSchemaFingerprint == true))
+    {
+        schemaFingerprintCache.schemaFingerprintMap[databasePath] = schemaFingerprint;
+    }
+    else
+    {
+        schemaFingerprintCache.schemaFingerprintMap.erase(databasePath);
+    }
+
+    return retValue;
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::GetSchemaFingerprint_(
+    _In_ const std::vector<std::string>& verifyTableStmtStringList,
+    _Out_ SchemaFingerprint& schemaFingerprint
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int sqliteStatus = SQLITE_ERROR;
+    const std::string::traits_type::char_type* schemaSql = nullptr;
+    uint64_t hash = 0;
+
+    // 스키마가 비어있어도 버전 값이 리턴되도록 LEFT JOIN
+    const char* schemaFingerprintStmtString =
+        "SELECT s.schema_version, u.user_version, m.sql FROM pragma_schema_version s, pragma_user_version u LEFT JOIN sqlite_master m;";
+
+    auto raii = RAIIRegister([&]
+        {
+            if (schemaFingerprintStmt_ != nullptr)
+            {
+                sqlite3_reset(schemaFingerprintStmt_);
+            }
+        });
+
+    if (schemaFingerprintStmt_ == nullptr)
+    {
+        sqliteStatus = SqlitePrepareV3_(
+            database_,
+            schemaFingerprintStmtString,
+            -1,
+            SQLITE_PREPARE_PERSISTENT,
+            &schemaFingerprintStmt_,
+            nullptr
+        );
+        if (sqliteStatus != SQLITE_OK)
+        {
+            schemaFingerprintStmt_ = nullptr;
+            return retValue;
+        }
+    }
+
+    schemaFingerprint = SchemaFingerprint();
+    schemaFingerprint.schemaHash = GetStmtStringHash_("", 0);
+
+    while (true)
+    {
+        sqliteStatus = RetryOnBusy_(
+            [&]
+            {
+                return sqlite3_step(schemaFingerprintStmt_);
+            },
+            schemaFingerprintStmt_,
+            nullptr
+        );
+        if (sqliteStatus == SQLITE_DONE)
+        {
+            break;
+        }
+        else if (sqliteStatus != SQLITE_ROW)
+        {
+            return retValue;
+        }
+
+        schemaFingerprint.schemaVersion = sqlite3_column_int64(schemaFingerprintStmt_, 0);
+        schemaFingerprint.userVersion = sqlite3_column_int64(schemaFingerprintStmt_, 1);
+
+        schemaSql = reinterpret_cast<const std::string::traits_type::char_type*>(sqlite3_column_text(schemaFingerprintStmt_, 2));
+        if (schemaSql != nullptr)
+        {
+            hash = GetStmtStringHash_(schemaSql, std::string::traits_type::length(schemaSql));
+            schemaFingerprint.schemaHash = (schemaFingerprint.schemaHash ^ hash) * 1099511628211ULL;
+        }
+    }
+
+    schemaFingerprint.verifyTableStmtStringListHash = GetStmtStringHash_("", 0);
+    for (const auto& verifyTableStmtStringListEntry : verifyTableStmtStringList)
+    {
+        hash = GetStmtStringHash_(verifyTableStmtStringListEntry.c_str(), verifyTableStmtStringListEntry.size());
+        schemaFingerprint.verifyTableStmtStringListHash = (schemaFingerprint.verifyTableStmtStringListHash ^ hash) * 1099511628211ULL;
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+EzSqlite::SqliteManager::SchemaFingerprintCache& EzSqlite::SqliteManager::GetSchemaFingerprintCache_()
+{
+    static SchemaFingerprintCache schemaFingerprintCache;
+
+    return schemaFingerprintCache;
+}
+
+EzSqlite::Errors EzSqlite::SqliteManager::VerifyTable_(
+    _In_ const std::vector<std::string>& verifyTableStmtStringList,
+    _Out_ uint32_t& verifyPrepareCount
+)
+{
+    Errors retValue = Errors::kFailedVerifyTable;
+
+    int sqliteStatus = SQLITE_ERROR;
+
+    sqlite3_stmt* stmt = nullptr;
+
+    auto raii = RAIIRegister([&]
+        {
+            if (stmt != nullptr)
+            {
+                sqlite3_finalize(stmt);
+                stmt = nullptr;
+            }
+        });
+
+    verifyPrepareCount = 0;
+
+    if (verifyTableStmtStringList.size() == 0)
+    {
+        retValue = Errors::kSuccess;
+        return retValue;
+    }
+
+    retValue = Errors::kSuccess;
+    for (const auto& verifyTableStmtStringListEntry : verifyTableStmtStringList)
+    {
+        if (GetStmtType_(verifyTableStmtStringListEntry.c_str()) != StmtType::kSelect)
+        {
+            retValue = Errors::kFailedVerifyTable;
+            break;
+        }
+
+        verifyPrepareCount++;
+        sqliteStatus = SqlitePrepareV2_(
+            database_,
+            verifyTableStmtStringListEntry.c_str(),
+            -1,
+            &stmt,
+            nullptr
+        );
+        if (sqliteStatus != SQLITE_OK)
+        {
+            retValue = Errors::kFailedVerifyTable;
+            break;
+        }
+
+        sqlite3_finalize(stmt);
+        stmt = nullptr;
+    }
+
+    return retValue;
+}
+
+template <typename SqliteFunction>
+int EzSqlite::SqliteManager::RetryOnBusy_(
+    _In_ SqliteFunction&& sqliteFunction,
+    _In_opt_ sqlite3_stmt* resetStmt,
+    _Inout_opt_ BusyWaitHistogram* stmtBusyWaitHistogram
+)
+{
+    int sqliteStatus = SQLITE_ERROR;
+
+    uint32_t retryCount = 0;
+    bool busyWaited = false;
+    std::chrono::steady_clock::time_point busyBeginTime;
+    uint64_t waitMilliseconds = 0;
+
+    // sqlite3_stmt_busy는 sqlite3_step이 SQLITE_ROW를 리턴한 후 reset 전까지 true
+    const bool rowReturned = (resetStmt != nullptr) && (sqlite3_stmt_busy(resetStmt) != 0);
+
+    busyHandlerInvoked_ = false;
+
+    while (true)
+    {
+        sqliteStatus = sqliteFunction();
+        if ((sqliteStatus != SQLITE_BUSY) && (sqliteStatus != SQLITE_LOCKED))
+        {
+            break;
+        }
+
+        // kBusyHandler인 경우 SQLITE_BUSY는 BusyHandler_에서 이미 대기 시간을 초과했거나 SQLite가 교착 상태로 판단한 경우
+        if ((busyOptions_.strategy == BusyStrategy::kBusyHandler) && (sqliteStatus == SQLITE_BUSY))
+        {
+            break;
+        }
+
+        // 이미 행을 리턴한 명령문은 reset 후 다시 실행하면 처음 행부터 다시 리턴되므로 SQLITE_LOCKED를 그대로 리턴
+        if ((sqliteStatus == SQLITE_LOCKED) && (rowReturned == true))
+        {
+            break;
+        }
+
+        if (busyWaited == false)
+        {
+            busyWaited = true;
+            busyBeginTime = std::chrono::steady_clock::now();
+        }
+
+        if (WaitBusy_(sqliteStatus, retryCount, busyBeginTime) == false)
+        {
+            break;
+        }
+        retryCount++;
+
+        if ((sqliteStatus == SQLITE_LOCKED) && (resetStmt != nullptr))
+        {
+            sqlite3_reset(resetStmt);
+        }
+    }
+
+    if ((busyHandlerInvoked_ == true) && ((busyWaited == false) || (busyHandlerBeginTime_ < busyBeginTime)))
+    {
+        busyWaited = true;
+        busyBeginTime = busyHandlerBeginTime_;
+    }
+
+    if (busyWaited == true)
+    {
+        waitMilliseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - busyBeginTime).count());
+
+        RecordBusyWait_(busyWaitHistogram_, waitMilliseconds, (sqliteStatus == SQLITE_BUSY) || (sqliteStatus == SQLITE_LOCKED));
+        if (stmtBusyWaitHistogram != nullptr)
+        {
+            RecordBusyWait_(*stmtBusyWaitHistogram, waitMilliseconds, (sqliteStatus == SQLITE_BUSY) || (sqliteStatus == SQLITE_LOCKED));
+        }
+    }
+
+    return sqliteStatus;
+}
+
+bool EzSqlite::SqliteManager::WaitBusy_(
+    _In_ int sqliteStatus,
+    _In_ uint32_t retryCount,
+    _In_ std::chrono::steady_clock::time_point busyBeginTime
+)
+{
+    uint64_t elapsedMilliseconds = 0;
+    uint64_t waitMilliseconds = 0;
+
+    elapsedMilliseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - busyBeginTime).count());
+    if (elapsedMilliseconds >= busyOptions_.timeOutMilliseconds)
+    {
+        return false;
+    }
+
+#ifdef SQLITE_ENABLE_UNLOCK_NOTIFY
+    if ((busyOptions_.strategy == BusyStrategy::kUnlockNotify) && (sqliteStatus == SQLITE_LOCKED))
+    {
+        return WaitUnlockNotify_(busyBeginTime);
+    }
+#else
+    UNREFERENCED_PARAMETER(sqliteStatus);
+#endif
+
+    if (busyOptions_.strategy == BusyStrategy::kSleepPolling)
+    {
+        waitMilliseconds = busyOptions_.pollingIntervalMilliseconds;
+    }
+    else
+    {
+        waitMilliseconds = GetBackoffMilliseconds_(busyOptions_, retryCount, busyBackoffRandom_);
+    }
+
+    // 남은 시간보다 오래 대기하지 않음
+    waitMilliseconds = (std::min)(waitMilliseconds, busyOptions_.timeOutMilliseconds - elapsedMilliseconds);
+    Sleep(static_cast<uint32_t>(waitMilliseconds));
+
+    return true;
+}
+
+#ifdef SQLITE_ENABLE_UNLOCK_NOTIFY
+namespace
+{
+struct UnlockNotification
+{
+    UnlockNotification()
+    {
+        fired = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    bool fired;
+};
+}
+
+bool EzSqlite::SqliteManager::WaitUnlockNotify_(
+    _In_ std::chrono::steady_clock::time_point busyBeginTime
+)
+{
+    bool retValue = false;
+
+    int sqliteStatus = SQLITE_ERROR;
+    UnlockNotification unlockNotification;
+
+    // 잠금을 보유한 연결이 없으면 바로 콜백이 호출됨, SQLITE_LOCKED가 리턴되면 교착 상태이므로 대기하지 않음
+    sqliteStatus = sqlite3_unlock_notify(database_, UnlockNotifyCallback_, &unlockNotification);
+    if (sqliteStatus != SQLITE_OK)
+    {
+        return retValue;
+    }
+
+    std::unique_lock<std::mutex> lock(unlockNotification.mutex);
+    retValue = unlockNotification.conditionVariable.wait_until(
+        lock,
+        busyBeginTime + std::chrono::milliseconds(busyOptions_.timeOutMilliseconds),
+        [&]
+        {
+            return unlockNotification.fired;
+        });
+
+    if (retValue == false)
+    {
+        // 대기 시간 초과, 등록된 콜백 취소 (이후 unlockNotification이 소멸되어도 호출되지 않음)
+        lock.unlock();
+        sqlite3_unlock_notify(database_, nullptr, nullptr);
+    }
+
+    return retValue;
+}
+
+void EzSqlite::SqliteManager::UnlockNotifyCallback_(
+    void** userContextList,
+    int userContextCount
+)
+{
+    for (int userContextIndex = 0; userContextIndex < userContextCount; userContextIndex++)
+    {
+        UnlockNotification* unlockNotification = static_cast<UnlockNotification*>(userContextList[userContextIndex]);
+
+        std::lock_guard<std::mutex> lock(unlockNotification->mutex);
+        unlockNotification->fired = true;
+        unlockNotification->conditionVariable.notify_all();
+    }
+}
+#endif
+
+void EzSqlite::SqliteManager::ApplyBusyHandler_()
+{
+    if (database_ == nullptr)
+    {
+        return;
+    }
+
+    if (busyOptions_.strategy == BusyStrategy::kBusyHandler)
+    {
+        sqlite3_busy_handler(database_, BusyHandler_, this);
+    }
+    else
+    {
+        sqlite3_busy_handler(database_, nullptr, nullptr);
+    }
+}
+
+int EzSqlite::SqliteManager::BusyHandler_(
+    void* userContext,
+    int invokeCount
+)
+{
+    SqliteManager* sqliteManager = static_cast<SqliteManager*>(userContext);
+
+    uint64_t elapsedMilliseconds = 0;
+    uint64_t waitMilliseconds = 0;
+
+    // 대기 시간은 RetryOnBusy_ 한 번의 호출 안에서 처음 잠금을 만난 시점부터 계산
+    if ((invokeCount == 0) && (sqliteManager->busyHandlerInvoked_ == false))
+    {
+        sqliteManager->busyHandlerInvoked_ = true;
+        sqliteManager->busyHandlerBeginTime_ = std::chrono::steady_clock::now();
+    }
+
+    elapsedMilliseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - sqliteManager->busyHandlerBeginTime_).count());
+    if (elapsedMilliseconds >= sqliteManager->busyOptions_.timeOutMilliseconds)
+    {
+        // 0을 리턴하면 SQLite가 SQLITE_BUSY 리턴
+        return 0;
+    }
+
+    waitMilliseconds = GetBackoffMilliseconds_(sqliteManager->busyOptions_, static_cast<uint32_t>(invokeCount), sqliteManager->busyBackoffRandom_);
+    waitMilliseconds = (std::min)(waitMilliseconds, sqliteManager->busyOptions_.timeOutMilliseconds - elapsedMilliseconds);
+    Sleep(static_cast<uint32_t>(waitMilliseconds));
+
+    return 1;
+}
+
+uint32_t EzSqlite::SqliteManager::GetBackoffMilliseconds_(
+    _In_ const BusyOptions& busyOptions,
+    _In_ uint32_t retryCount,
+    _Inout_ std::minstd_rand& random
+)
+{
+    uint64_t backoffMilliseconds = 0;
+
+    // initialBackoffMilliseconds * 2^retryCount (maxBackoffMilliseconds 이하)
+    backoffMilliseconds = static_cast<uint64_t>(busyOptions.initialBackoffMilliseconds) << (std::min)(retryCount, 31u);
+    backoffMilliseconds = (std::min)(backoffMilliseconds, static_cast<uint64_t>(busyOptions.maxBackoffMilliseconds));
+
+    // 여러 연결이 같은 주기로 재시도하지 않도록 [backoff / 2, backoff] 범위의 지터 적용
+    backoffMilliseconds -= random() % (backoffMilliseconds / 2 + 1);
+
+    return static_cast<uint32_t>(backoffMilliseconds);
+}
+
+void EzSqlite::SqliteManager::RecordBusyWait_(
+    _Inout_ BusyWaitHistogram& busyWaitHistogram,
+    _In_ uint64_t waitMilliseconds,
+    _In_ bool timedOut
+)
+{
+    uint32_t bucketIndex = 0;
+
+    while (((waitMilliseconds >> bucketIndex) != 0) && (bucketIndex < kBusyWaitHistogramBucketNumber - 1))
+    {
+        bucketIndex++;
+    }
+
+    busyWaitHistogram.bucketList[bucketIndex]++;
+    busyWaitHistogram.waitCount++;
+    busyWaitHistogram.totalWaitMilliseconds += waitMilliseconds;
+    busyWaitHistogram.maxWaitMilliseconds = (std::max)(busyWaitHistogram.maxWaitMilliseconds, waitMilliseconds);
+    if (timedOut == true)
+    {
+        busyWaitHistogram.timeOutCount++;
+    }
+}
+
+int EzSqlite::SqliteManager::SqliteStep_(
+    const StmtInfo& stmtInfo
+)
+{
+    int sqliteStatus = RetryOnBusy_(
+        [&]
+        {
+            return sqlite3_step(stmtInfo.stmt);
+        },
+        stmtInfo.stmt,
+        &stmtInfo.busyWaitHistogram
+    );
+
+    if (committedDataChangeRangeList_.empty() == false)
+    {
+        DeliverDataChange_(sqliteStatus);
+    }
+
+    return sqliteStatus;
+}
+
+int EzSqlite::SqliteManager::SqlitePrepareV2_(
+    sqlite3* db,
+    const char* zSql,
+    int nBytes,
+    sqlite3_stmt** ppStmt,
+    const char** pzTail
+)
+{
+    return RetryOnBusy_(
+        [&]
+        {
+            return sqlite3_prepare_v2(
+                db,
+                zSql,
+                nBytes,
+                ppStmt,
+                pzTail
+            );
+        },
+        nullptr,
+        nullptr
+    );
+}
+
+int EzSqlite::SqliteManager::SqlitePrepareV3_(
+    sqlite3* db,
+    const char* zSql,
+    int nBytes,
+    unsigned int prepFlags,
+    sqlite3_stmt** ppStmt,
+    const char** pzTail
+)
+{
+    return RetryOnBusy_(
+        [&]
+        {
+            return sqlite3_prepare_v3(
+                db,
+                zSql,
+                nBytes,
+                prepFlags,
+                ppStmt,
+                pzTail
+            );
+        },
+        nullptr,
+        nullptr
+    );
+}
+
+void EzSqlite::SqliteManager::SqliteUpdateHook_(
+    sqlite3* db,
+    FPDataChangeNotificationCallback dataChangeNotificationCallback,
+    void* userContext
+)
+{
+    sqlite3_update_hook(
+        db,
+        (void(*)(void*, int, char const*, char const*, sqlite_int64))(dataChangeNotificationCallback),
+        userContext
+    );
+}
+
+void EzSqlite::SqliteManager::ApplyDataChangeHook_()
+{
+    if (database_ == nullptr)
+    {
+        return;
+    }
+
+    pendingDataChangeRangeList_.clear();
+    openDataChangeRangeIndexList_.clear();
+    committedDataChangeRangeList_.clear();
+
+    if (batchDataChangeNotificationCallback_ != nullptr)
+    {
+        sqlite3_update_hook(database_, BatchUpdateHook_, this);
+        sqlite3_commit_hook(database_, CommitHook_, this);
+        sqlite3_rollback_hook(database_, RollbackHook_, this);
+        return;
+    }
+
+    sqlite3_commit_hook(database_, nullptr, nullptr);
+    sqlite3_rollback_hook(database_, nullptr, nullptr);
+    SqliteUpdateHook_(
+        database_,
+        dataChangeNotificationCallback_,
+        dataChangeNotificationCallbackUserContext_
+    );
+}
+
+void EzSqlite::SqliteManager::BatchUpdateHook_(
+    void* userContext,
+    int actionCode,
+    char const* dbName,
+    char const* tableName,
+    sqlite_int64 rowid
+)
+{
+    SqliteManager* sqliteManager = static_cast<SqliteManager*>(userContext);
+    std::vector<DataChangeRange>& pendingDataChangeRangeList = sqliteManager->pendingDataChangeRangeList_;
+
+    DataChangeRange dataChangeRange;
+
+    for (auto& openDataChangeRangeIndex : sqliteManager->openDataChangeRangeIndexList_)
+    {
+        DataChangeRange& openDataChangeRange = pendingDataChangeRangeList[openDataChangeRangeIndex];
+
+        if ((strcmp(openDataChangeRange.tableName, tableName) != 0) || (strcmp(openDataChangeRange.dbName, dbName) != 0))
+        {
+            continue;
         }
 
-        if (sqliteStatus != SQLITE_OK)
+        if (openDataChangeRange.actionCode == static_cast<CallbackActionCode>(actionCode))
         {
-            return retValue;
+            if (rowid == openDataChangeRange.lastRowid + 1)
+            {
+                openDataChangeRange.lastRowid = rowid;
+                return;
+            }
+
+            if ((rowid == openDataChangeRange.lastRowid) && (openDataChangeRange.actionCode == CallbackActionCode::kUpdate))
+            {
+                return;
+            }
         }
+
+        // 테이블별 순서를 유지하기 위해 해당 테이블의 마지막 범위를 새 범위로 교체
+        dataChangeRange.actionCode = static_cast<CallbackActionCode>(actionCode);
+        dataChangeRange.dbName = openDataChangeRange.dbName;
+        dataChangeRange.tableName = openDataChangeRange.tableName;
+        dataChangeRange.firstRowid = rowid;
+        dataChangeRange.lastRowid = rowid;
+
+        openDataChangeRangeIndex = static_cast<uint32_t>(pendingDataChangeRangeList.size());
+        pendingDataChangeRangeList.push_back(dataChangeRange);
+        return;
     }
 
-    retValue = Errors::kSuccess;
-    return retValue;
+    dataChangeRange.actionCode = static_cast<CallbackActionCode>(actionCode);
+    dataChangeRange.dbName = sqliteManager->InternDataChangeName_(dbName);
+    dataChangeRange.tableName = sqliteManager->InternDataChangeName_(tableName);
+    dataChangeRange.firstRowid = rowid;
+    dataChangeRange.lastRowid = rowid;
+
+    sqliteManager->openDataChangeRangeIndexList_.push_back(static_cast<uint32_t>(pendingDataChangeRangeList.size()));
+    pendingDataChangeRangeList.push_back(dataChangeRange);
 }
 
-EzSqlite::Errors EzSqlite::SqliteManager::PragmaStmtBindParameter_(
-    _In_ const StmtInfo& stmtInfo,
-    _In_ const std::vector<StmtBindParameterInfo>& stmtBindParameterInfoList,
-    _Out_ std::string& pragmaStmtString
+int EzSqlite::SqliteManager::CommitHook_(
+    void* userContext
 )
 {
-    Errors retValue = Errors::kUnsuccess;
+    SqliteManager* sqliteManager = static_cast<SqliteManager*>(userContext);
 
-    size_t pragmaStmtStringOffset = 0;
+    /*
+        COMMIT Hook은 COMMIT이 완료되기 전에 호출되고 SQLITE_BUSY로 실패하면 재시도 시 다시 호출됨
+        COMMIT이 완료된 것을 확인한 후 SqliteStep_에서 전달
+    */
+    if (sqliteManager->committedDataChangeRangeList_.empty() == true)
+    {
+        sqliteManager->committedDataChangeRangeList_.swap(sqliteManager->pendingDataChangeRangeList_);
+    }
+    else
+    {
+        sqliteManager->committedDataChangeRangeList_.insert(
+            sqliteManager->committedDataChangeRangeList_.end(),
+            sqliteManager->pendingDataChangeRangeList_.begin(),
+            sqliteManager->pendingDataChangeRangeList_.end()
+        );
+    }
 
-    auto raii = RAIIRegister([&]
-        {
-            if ((retValue != Errors::kSuccess) && (pragmaStmtString.length() != 0))
-            {
-                pragmaStmtString.clear();
-            }
-        });
+    sqliteManager->pendingDataChangeRangeList_.clear();
+    sqliteManager->openDataChangeRangeIndexList_.clear();
 
-    pragmaStmtString = stmtInfo.stmtString;
+    // 0이 아니면 COMMIT이 ROLLBACK으로 바뀜
+    return 0;
+}
 
-    for (const auto& stmtBindParameterInfoListEntry : stmtBindParameterInfoList)
-    {
-        pragmaStmtStringOffset = pragmaStmtString.find_first_of('?', pragmaStmtStringOffset);
-        pragmaStmtString.erase(pragmaStmtStringOffset, 1);
+void EzSqlite::SqliteManager::RollbackHook_(
+    void* userContext
+)
+{
+    SqliteManager* sqliteManager = static_cast<SqliteManager*>(userContext);
 
-        switch (stmtBindParameterInfoListEntry.dataType)
+    sqliteManager->pendingDataChangeRangeList_.clear();
+    sqliteManager->openDataChangeRangeIndexList_.clear();
+    sqliteManager->committedDataChangeRangeList_.clear();
+}
+
+const char* EzSqlite::SqliteManager::InternDataChangeName_(
+    _In_ const char* name
+)
+{
+    for (const auto& dataChangeName : dataChangeNameList_)
+    {
+        if (dataChangeName == name)
         {
-        case StmtDataType::kInteger:
-            if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int8_t))
-            {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int8_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint8_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-            }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int16_t))
-            {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int16_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint16_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-            }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int32_t))
-            {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int32_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint32_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-            }
-            else if (stmtBindParameterInfoListEntry.dataByteSize == sizeof(int64_t))
-            {
-                if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kSigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const int64_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-                else if (stmtBindParameterInfoListEntry.options == StmtBindParameterOptions::kUnsigned)
-                {
-                    pragmaStmtString.insert(pragmaStmtStringOffset, std::to_string(*reinterpret_cast<const uint64_t*>(stmtBindParameterInfoListEntry.data)));
-                }
-            }
-            break;
-            // [TODO] Ʒ Type ʿ  
-        case StmtDataType::kFloat:
-            return retValue;
-        case StmtDataType::kText:
-            return retValue;
-        case StmtDataType::kBlob:
-            return retValue;
-        case StmtDataType::kNull:
-            return retValue;
+            return dataChangeName.c_str();
         }
     }
 
-    retValue = Errors::kSuccess;
-    return retValue;
+    dataChangeNameList_.emplace_back(name);
+    return dataChangeNameList_.back().c_str();
 }
 
-EzSqlite::Errors EzSqlite::SqliteManager::VerifyTable_(
-    _In_ const std::vector<std::string>& verifyTableStmtStringList
+void EzSqlite::SqliteManager::DeliverDataChange_(
+    _In_ int sqliteStatus
 )
 {
-    Errors retValue = Errors::kFailedVerifyTable;
+    std::vector<DataChangeRange> dataChangeRangeList;
 
-    int sqliteStatus = SQLITE_ERROR;
+    // 자동 커밋 모드로 돌아오지 않았으면 COMMIT이 SQLITE_BUSY 등으로 아직 완료되지 않은 것
+    if (sqlite3_get_autocommit(database_) == 0)
+    {
+        return;
+    }
 
-    sqlite3_stmt* stmt = nullptr;
+    // 콜백에서 다시 변경이 발생해도 목록이 바뀌지 않도록 분리 (용량은 다음 트랜잭션에서 재사용)
+    dataChangeRangeList.swap(committedDataChangeRangeList_);
 
-    auto raii = RAIIRegister([&]
-        {
-            if (stmt != nullptr)
-            {
-                sqlite3_finalize(stmt);
-                stmt = nullptr;
-            }
-        });
+    if (((sqliteStatus == SQLITE_ROW) || (sqliteStatus == SQLITE_DONE)) &&
+        (batchDataChangeNotificationCallback_ != nullptr))
+    {
+        batchDataChangeNotificationCallback_(
+            batchDataChangeNotificationCallbackUserContext_,
+            dataChangeRangeList.data(),
+            static_cast<uint32_t>(dataChangeRangeList.size())
+        );
+    }
 
-    if (verifyTableStmtStringList.size() == 0)
+    dataChangeRangeList.clear();
+    if (committedDataChangeRangeList_.empty() == true)
     {
-        retValue = Errors::kSuccess;
-        return retValue;
+        committedDataChangeRangeList_.swap(dataChangeRangeList);
     }
+}
 
-    retValue = Errors::kSuccess;
-    for (const auto& verifyTableStmtStringListEntry : verifyTableStmtStringList)
+EzSqlite::ResultCursor::ResultCursor(
+    _In_ SqliteManager* sqliteManager,
+    _In_opt_ const StmtInfo* stmtInfo,
+    _In_ Errors status
+)
+{
+    sqliteManager_ = sqliteManager;
+    stmtInfo_ = stmtInfo;
+    status_ = status;
+    stepCount_ = 0;
+    finished_ = (stmtInfo == nullptr);
+}
+
+EzSqlite::ResultCursor::ResultCursor(
+    _Inout_ ResultCursor&& resultCursor
+)
+{
+    sqliteManager_ = resultCursor.sqliteManager_;
+    stmtInfo_ = resultCursor.stmtInfo_;
+    status_ = resultCursor.status_;
+    stepCount_ = resultCursor.stepCount_;
+    finished_ = resultCursor.finished_;
+
+    resultCursor.stmtInfo_ = nullptr;
+    resultCursor.finished_ = true;
+}
+
+EzSqlite::ResultCursor::~ResultCursor()
+{
+    if (stmtInfo_ != nullptr)
     {
-        if (GetStmtType_(verifyTableStmtStringListEntry.c_str()) != StmtType::kSelect)
-        {
-            retValue = Errors::kFailedVerifyTable;
-            break;
-        }
+        sqlite3_clear_bindings(stmtInfo_->stmt);
+        sqlite3_reset(stmtInfo_->stmt);
+        stmtInfo_ = nullptr;
+    }
+}
 
-        sqliteStatus = SqlitePrepareV2_(
-            database_,
-            verifyTableStmtStringListEntry.c_str(),
-            -1,
-            &stmt,
-            nullptr
-        );
-        if (sqliteStatus != SQLITE_OK)
+EzSqlite::ResultCursor::Iterator EzSqlite::ResultCursor::begin()
+{
+    if (stepCount_ == 0)
+    {
+        if (Next() == false)
         {
-            retValue = Errors::kFailedVerifyTable;
-            break;
+            return end();
         }
-
-        sqlite3_finalize(stmt);
-        stmt = nullptr;
+    }
+    else if (finished_ == true)
+    {
+        return end();
     }
 
-    return retValue;
+    return Iterator(this);
 }
 
-int EzSqlite::SqliteManager::SqliteStep_(
-    sqlite3_stmt* stmt,
-    uint32_t timeOutSecond /*= kBusyTimeOutSecond*/
-)
+EzSqlite::ResultCursor::Iterator EzSqlite::ResultCursor::end()
+{
+    return Iterator();
+}
+
+bool EzSqlite::ResultCursor::Next()
 {
     int sqliteStatus = SQLITE_ERROR;
 
-    const double_t intervalTime = 0.5;
-    double_t stayTime = 0;
+    if (finished_ == true)
+    {
+        return false;
+    }
 
-    while (true)
+    sqliteStatus = sqliteManager_->SqliteStep_(*stmtInfo_);
+    stepCount_++;
+
+    if (sqliteStatus == SQLITE_ROW)
     {
-        sqliteStatus = sqlite3_step(
-            stmt
-        );
+        return true;
+    }
+
+    finished_ = true;
 
-        if ((sqliteStatus != SQLITE_BUSY) || (stayTime >= timeOutSecond))
+    if (sqliteStatus == SQLITE_DONE)
+    {
+        if ((stmtInfo_->stmtType == StmtType::kSelect) && (stepCount_ == 1))
         {
-            break;
+            status_ = Errors::kNoResult;
         }
-
-        Sleep(static_cast<uint32_t>(intervalTime * 1000));
-        stayTime += intervalTime;
+        else
+        {
+            status_ = Errors::kSuccess;
+        }
+    }
+    else
+    {
+        status_ = Errors::kUnsuccess;
     }
 
-    return sqliteStatus;
+    return false;
 }
 
-int EzSqlite::SqliteManager::SqlitePrepareV2_(
-    sqlite3* db,
-    const char* zSql,
-    int nBytes,
-    sqlite3_stmt** ppStmt,
-    const char** pzTail,
-    uint32_t timeOutSecond /*= kBusyTimeOutSecond*/
+EzSqlite::ResultRow EzSqlite::ResultCursor::GetRow() const
+{
+    return ResultRow(stmtInfo_ == nullptr ? nullptr : stmtInfo_->stmt);
+}
+
+EzSqlite::Errors EzSqlite::ResultCursor::FetchColumnBatch(
+    _In_ uint32_t maxRowCount,
+    _Inout_ std::vector<ColumnBuffer>& columnBufferList,
+    _Out_ uint32_t& fetchedRowCount
 )
 {
-    int sqliteStatus = SQLITE_ERROR;
+    Errors retValue = Errors::kUnsuccess;
 
-    const double_t intervalTime = 0.5;
-    double_t stayTime = 0;
+    fetchedRowCount = 0;
 
-    while (true)
+    for (auto& columnBufferListEntry : columnBufferList)
     {
-        sqliteStatus = sqlite3_prepare_v2(
-            db,
-            zSql,
-            nBytes,
-            ppStmt,
-            pzTail
-        );
+        columnBufferListEntry.integerList.clear();
+        columnBufferListEntry.floatList.clear();
+        columnBufferListEntry.offsetList.clear();
+        columnBufferListEntry.arena.clear();
+        columnBufferListEntry.nullBitmap.clear();
 
-        if ((sqliteStatus != SQLITE_BUSY) || (stayTime >= timeOutSecond))
+        if ((columnBufferListEntry.dataType == StmtDataType::kText) || (columnBufferListEntry.dataType == StmtDataType::kBlob))
         {
-            break;
+            columnBufferListEntry.offsetList.push_back(0);
+        }
+
+        if ((stmtInfo_ != nullptr) && (columnBufferListEntry.columnIndex >= stmtInfo_->columnCount))
+        {
+            return retValue;
         }
+    }
 
-        Sleep(static_cast<uint32_t>(intervalTime * 1000));
-        stayTime += intervalTime;
+    // 처음 호출된 경우 첫 행으로 이동, 이후에는 이전 호출에서 읽지 않은 현재 행부터 시작
+    if (stepCount_ == 0)
+    {
+        Next();
     }
 
-    return sqliteStatus;
+    while ((finished_ == false) && (fetchedRowCount < maxRowCount))
+    {
+        for (auto& columnBufferListEntry : columnBufferList)
+        {
+            AppendColumnBuffer_(columnBufferListEntry, fetchedRowCount);
+        }
+
+        fetchedRowCount++;
+        Next();
+    }
+
+    if (fetchedRowCount != 0)
+    {
+        retValue = Errors::kSuccess;
+    }
+    else if ((status_ == Errors::kSuccess) || (status_ == Errors::kNoResult))
+    {
+        retValue = Errors::kNoResult;
+    }
+    else
+    {
+        retValue = status_;
+    }
+
+    return retValue;
 }
 
-int EzSqlite::SqliteManager::SqlitePrepareV3_(
-    sqlite3* db,
-    const char* zSql,
-    int nBytes,
-    unsigned int prepFlags,
-    sqlite3_stmt** ppStmt,
-    const char** pzTail,
-    uint32_t timeOutSecond /*= kBusyTimeOutSecond */
+void EzSqlite::ResultCursor::AppendColumnBuffer_(
+    _Inout_ ColumnBuffer& columnBuffer,
+    _In_ uint32_t rowIndex
 )
 {
-    int sqliteStatus = SQLITE_ERROR;
+    sqlite3_stmt* stmt = stmtInfo_->stmt;
+    int columnIndex = static_cast<int>(columnBuffer.columnIndex);
 
-    const double_t intervalTime = 0.5;
-    double_t stayTime = 0;
+    const void* columnData = nullptr;
+    uint32_t columnByteSize = 0;
+    bool nullCandidate = false;
 
-    while (true)
+    if ((rowIndex % 8) == 0)
     {
-        sqliteStatus = sqlite3_prepare_v3(
-            db,
-            zSql,
-            nBytes,
-            prepFlags,
-            ppStmt,
-            pzTail
-        );
+        columnBuffer.nullBitmap.push_back(0);
+    }
 
-        if ((sqliteStatus != SQLITE_BUSY) || (stayTime >= timeOutSecond))
+    switch (columnBuffer.dataType)
+    {
+    case StmtDataType::kInteger:
+        columnBuffer.integerList.push_back(sqlite3_column_int64(stmt, columnIndex));
+        nullCandidate = (columnBuffer.integerList.back() == 0);
+        break;
+
+    case StmtDataType::kFloat:
+        columnBuffer.floatList.push_back(sqlite3_column_double(stmt, columnIndex));
+        nullCandidate = (columnBuffer.floatList.back() == 0);
+        break;
+
+    case StmtDataType::kText:
+    case StmtDataType::kBlob:
+        // sqlite3_column_bytes는 sqlite3_column_text, sqlite3_column_blob 이후에 호출
+        if (columnBuffer.dataType == StmtDataType::kText)
         {
-            break;
+            columnData = sqlite3_column_text(stmt, columnIndex);
+        }
+        else
+        {
+            columnData = sqlite3_column_blob(stmt, columnIndex);
+        }
+        columnByteSize = static_cast<uint32_t>(sqlite3_column_bytes(stmt, columnIndex));
+
+        if (columnData != nullptr)
+        {
+            columnBuffer.arena.insert(
+                columnBuffer.arena.end(),
+                reinterpret_cast<const std::string::traits_type::char_type*>(columnData),
+                reinterpret_cast<const std::string::traits_type::char_type*>(columnData) + columnByteSize
+            );
         }
+        columnBuffer.offsetList.push_back(static_cast<uint32_t>(columnBuffer.arena.size()));
+        nullCandidate = (columnData == nullptr);
+        break;
 
-        Sleep(static_cast<uint32_t>(intervalTime * 1000));
-        stayTime += intervalTime;
+    case StmtDataType::kNull:
+        nullCandidate = true;
+        break;
     }
 
-    return sqliteStatus;
+    // sqlite3_column_type은 NULL일 때 읽히는 값(0, 0.0, nullptr)인 경우에만 호출 (행마다 컬럼 API 호출 수를 줄임)
+    if ((nullCandidate == true) && (sqlite3_column_type(stmt, columnIndex) == SQLITE_NULL))
+    {
+        columnBuffer.nullBitmap.back() |= static_cast<uint8_t>(1 << (rowIndex % 8));
+    }
 }
 
-void EzSqlite::SqliteManager::SqliteUpdateHook_(
-    sqlite3* db,
-    FPDataChangeNotificationCallback dataChangeNotificationCallback,
-    void* userContext
-)
+EzSqlite::Errors EzSqlite::ResultCursor::GetStatus() const
 {
-    sqlite3_update_hook(
-        db,
-        (void(*)(void*, int, char const*, char const*, sqlite_int64))(dataChangeNotificationCallback),
-        userContext
-    );
+    return status_;
 }
\ No newline at end of file
@@ -12,6 +12,17 @@
 #include <functional>
 #include <codecvt>
 #include <vector>
+#include <list>
+#include <deque>
+#include <utility>
+#include <type_traits>
+#include <tuple>
+#include <iterator>
+#include <unordered_map>
+#include <chrono>
+#include <random>
+#include <mutex>
+#include <condition_variable>
 
 #include <iostream>
 
@@ -19,16 +30,16 @@ namespace EzSqlite
 {
 
 /*
-    sqlite3_update_hook ݹ Լ
+    sqlite3_update_hook 콜백 함수
 
-    userContext: sqlite3_update_hook ° Ķ 纻
-    actionCode: ݹ ߻Ų Action (SQLITE_INSERT, SQLITE_DELETE, SQLITE_UPDATE)
-    dbName:  ޴ Database ̸
-    tableName:  ޴ Table ̸
-    rowid:   rowid  (Ʈ , Ʈ ߻  rowid)
+    userContext: sqlite3_update_hook 세번째 파라미터의 복사본
+    actionCode: 콜백을 발생시킨 Action (SQLITE_INSERT, SQLITE_DELETE, SQLITE_UPDATE)
+    dbName: 영향을 받는 Database 이름
+    tableName: 영향을 받는 Table 이름
+    rowid: 영향을 받은 rowid 값 (업데이트의 경우, 업데이트가 발생한 후의 rowid)
 
-     ý ̺ Ǵ  ݹ ȣ  (sqlite_master, sqlite_sequence)
-    WITHOUT ROWID ̺  ݹ ȣ 
+    내부 시스템 테이블이 수정되는 경우는 콜백 호출되지 않음 (sqlite_master, sqlite_sequence)
+    WITHOUT ROWID 테이블의 경우 콜백이 호출되지 않음
 */
 enum class CallbackActionCode
 {
@@ -45,9 +56,45 @@ typedef void (*FPDataChangeNotificationCallback)(
     sqlite_int64 rowid
     );
 
+/*
+    트랜잭션 단위로 모아서 전달되는 변경 범위 (SetBatchDataChangeNotificationCallback)
+
+    같은 테이블에서 같은 Action으로 rowid가 1씩 증가하며 연속된 변경은 하나의 범위로 합쳐짐 (UPDATE는 같은 rowid 중복도 제외)
+    테이블별 변경 순서는 유지되지만 서로 다른 테이블 사이의 순서는 보장하지 않음
+    dbName, tableName은 콜백 호출 중에만 유효
+*/
+struct DataChangeRange
+{
+    DataChangeRange()
+    {
+        actionCode = CallbackActionCode::kInsert;
+        dbName = nullptr;
+        tableName = nullptr;
+        firstRowid = 0;
+        lastRowid = 0;
+    };
+
+    CallbackActionCode actionCode;
+    char const* dbName;
+    char const* tableName;
+    sqlite_int64 firstRowid;
+    sqlite_int64 lastRowid;
+};
+
+typedef void (*FPBatchDataChangeNotificationCallback)(
+    void* userContext,
+    const DataChangeRange* dataChangeRangeList,
+    uint32_t dataChangeRangeCount
+    );
+
 const uint32_t kBusyTimeOutSecond = 30;
+const uint32_t kBusyWaitHistogramBucketNumber = 16;   // 1ms 미만, 2ms 미만, 4ms 미만, ... 2^14ms 미만, 그 이상
+const uint32_t kDefaultStmtCacheSize = 64;    // ExecStmt(stmtString)로 자동 Prepare된 명령문 캐시 최대 개수
+const uint32_t kCacheLineSize = 64;
+const uint32_t kDefaultBulkInsertChunkRowCount = 4096;
+const uint32_t kDefaultBulkInsertValuesRowCount = 1;
 
-/* std::string    utf8 */
+/* std::string으로 된 값은 전부 utf8 */
 
 enum class DesiredAccess
 {
@@ -57,9 +104,9 @@ enum class DesiredAccess
 
 enum class CreationDisposition
 {
-    kCreateAlways,  // DB    
-    kOpenAlways,    // DB  ִ  ,      
-    kOpenExisting   // DB  ִ  ,   
+    kCreateAlways,  // DB 파일 무조건 새로 생성
+    kOpenAlways,    // DB 파일 있는 경우 열고, 실패할 경우 새로 생성 후 열기
+    kOpenExisting   // DB 파일 있는 경우 열고, 실패할 경우 실패
 };
 
 enum class StmtIndex
@@ -70,37 +117,36 @@ enum class StmtIndex
     kRollback,              // ROLLBACK;
     kVacuum,                // VACUUM;
 
-    kBasicStmtNumber,
-    kNoIndex = -1
+    kBasicStmtNumber
 };
 
-// SQLite ϴ  Syntax   (  ¸ )
+// SQLite에서 제공하는 모든 Syntax를 고려하진 않음 (많이 쓰는 형태만 고려)
 enum class StmtType
 {
     kAlterTable,            // ALTER TABLE
     kAnalyze,               // ANALYZE
     kAttach,                // ATTACH
     kBegin,                 // BEGIN, BEGIN IMMEDIATE
-    kCommit,                // COMMIT
+    kCommit,                // COMMIT, END
     kCreateIndex,           // CREATE INDEX, CREATE UNIQUE INDEX
     kCreateTable,           // CREATE TABLE, CREATE TEMP TABLE, CREATE TEMPORARY TABLE
     kCreateTrigger,         // CREATE TRIGGER, CREATE TEMP TRIGGER, CREATE TEMPORARY TRIGGER
     kCreateView,            // CREATE VIEW, CREATE TEMP VIEW, CREATE TEMPORARY VIEW
     kCreateVirtualTable,    // CREATE VIRTUAL TABLE
-    kDelete,                // DELETE FROM
+    kDelete,                // DELETE FROM, WITH ... DELETE
     kDetach,                // DETACH
     kDropIndex,             // DROP INDEX
     kDropTable,             // DROP TABLE
     kDropTrigger,           // DROP TRIGGER
     kDropView,              // DROP VIEW
-    kInsert,                // INSERT INTO
+    kInsert,                // INSERT INTO, INSERT OR ..., REPLACE INTO, WITH ... INSERT
     kPragma,                // PRAGMA
     kReindex,               // REINDEX
     kRelease,               // RELEASE
     kRollback,              // ROLLBACK
     kSavepoint,             // SAVEPOINT
-    kSelect,                // SELECT
-    kUpdate,                // UPDATE
+    kSelect,                // SELECT, VALUES, WITH ... SELECT
+    kUpdate,                // UPDATE, UPDATE OR ..., WITH ... UPDATE
     kVacuum,                // VACUUM
     kUnknown
 };
@@ -138,8 +184,406 @@ struct StmtBindParameterInfo
 
     const void* data;
     StmtDataType dataType;
-    uint32_t dataByteSize;              // text interface  Default -1 (null )
-    StmtBindParameterOptions options;   // blob text interface  Default kDestructorTransient ( )
+    uint32_t dataByteSize;              // text interface인 경우 Default는 -1 (null까지 읽음)
+    StmtBindParameterOptions options;   // blob과 text interface인 경우 Default는 kDestructorTransient (값 복사)
+};
+
+// ExecStmtWithParameters용 텍스트 값 (복사하지 않고 SQLITE_STATIC으로 Bind, byteSize가 0이면 null 종료 문자열)
+struct StmtText
+{
+    StmtText()
+    {
+        data = nullptr;
+        byteSize = 0;
+    };
+    StmtText(_In_ const std::string::traits_type::char_type* textData, _In_ uint32_t textByteSize)
+    {
+        data = textData;
+        byteSize = textByteSize;
+    };
+
+    const std::string::traits_type::char_type* data;
+    uint32_t byteSize;
+};
+
+// ExecStmtWithParameters용 BLOB 값 (복사하지 않고 SQLITE_STATIC으로 Bind)
+struct StmtBlob
+{
+    StmtBlob()
+    {
+        data = nullptr;
+        byteSize = 0;
+    };
+    StmtBlob(_In_ const void* blobData, _In_ uint32_t blobByteSize)
+    {
+        data = blobData;
+        byteSize = blobByteSize;
+    };
+
+    const void* data;
+    uint32_t byteSize;
+};
+
+struct BulkInsertOptions
+{
+    BulkInsertOptions()
+    {
+        chunkRowCount = kDefaultBulkInsertChunkRowCount;
+        valuesRowCount = kDefaultBulkInsertValuesRowCount;
+    };
+
+    uint32_t chunkRowCount;     // 트랜잭션 하나에 포함되는 최대 행 수 (0이면 전체를 하나의 트랜잭션으로 처리)
+
+    /*
+        INSERT 명령문 하나에 포함되는 행 수 (INSERT INTO t(...) VALUES(?, ...), (?, ...), ...)
+        1이면 행마다 Step, 2 이상이면 여러 행을 한 번에 Bind해서 Step 한 번으로 INSERT
+        2의 거듭제곱으로 내림하고 Bind 파라미터 수가 SQLITE_LIMIT_VARIABLE_NUMBER를 넘지 않도록 줄임
+        남은 행은 절반 크기의 명령문으로 나눠서 처리하므로 테이블마다 최대 log2(valuesRowCount) + 1개의 명령문이 등록됨
+    */
+    uint32_t valuesRowCount;
+};
+
+// BulkInsert용 구조체 멤버 하나와 컬럼 하나의 대응 (MapColumn으로 생성)
+template <typename Row, typename Member>
+struct ColumnMapping
+{
+    ColumnMapping(_In_ const char* mappingColumnName, _In_ Member Row::* mappingMember)
+    {
+        columnName = mappingColumnName;
+        member = mappingMember;
+    };
+
+    const char* columnName;
+    Member Row::* member;
+};
+
+template <typename Row, typename Member>
+ColumnMapping<Row, Member> MapColumn(_In_ const char* columnName, _In_ Member Row::* member)
+{
+    return ColumnMapping<Row, Member>(columnName, member);
+}
+
+/*
+    구조체와 테이블 컬럼의 대응 (MakeTableMapping으로 한 번 만들어서 재사용)
+    멤버 타입별 Bind 함수는 컴파일 타임에 결정되며 규칙은 ExecStmtWithParameters와 동일
+    (정수형, float, double, const char*, char 배열, std::string, StmtText, StmtBlob)
+
+    예)
+    const auto kProcessEventTableMapping = MakeTableMapping<ProcessEvent>(
+        "PROCESSEVENT_TB",
+        MapColumn("C_TimeStamp", &ProcessEvent::timeStamp),
+        MapColumn("ED_ProcessId", &ProcessEvent::processId),
+        MapColumn("ED_ImageFileName", &ProcessEvent::imageFileName)
+    );
+*/
+template <typename Row, typename... Members>
+class TableMapping
+{
+    static_assert(sizeof...(Members) != 0, "TableMapping requires at least one column");
+
+public:
+    static const uint32_t kColumnCount = sizeof...(Members);
+
+    explicit TableMapping(_In_ const std::string& tableName, _In_ const ColumnMapping<Row, Members>&... columnMappings)
+        : memberList_(columnMappings.member...)
+    {
+        const char* columnNameList[] = { columnMappings.columnName... };
+
+        for (uint32_t columnIndex = 0; columnIndex < kColumnCount; columnIndex++)
+        {
+            columnsName_ += (columnIndex == 0) ? "" : ", ";
+            columnsName_ += columnNameList[columnIndex];
+        }
+        insertStmtPrefix_ = "INSERT INTO " + tableName + "(" + columnsName_ + ") VALUES";
+
+        valuesPlaceholder_ = "(";
+        for (uint32_t columnIndex = 0; columnIndex < kColumnCount; columnIndex++)
+        {
+            valuesPlaceholder_ += (columnIndex == 0) ? "?" : ", ?";
+        }
+        valuesPlaceholder_ += ")";
+    }
+
+    // valuesRowCount개 행을 INSERT하는 명령문
+    std::string GetInsertStmtString(_In_opt_ uint32_t valuesRowCount = 1) const
+    {
+        std::string insertStmtString;
+
+        insertStmtString.reserve(insertStmtPrefix_.length() + (valuesPlaceholder_.length() + 2) * valuesRowCount + 1);
+        insertStmtString = insertStmtPrefix_;
+        for (uint32_t valuesRowIndex = 0; valuesRowIndex < valuesRowCount; valuesRowIndex++)
+        {
+            insertStmtString += (valuesRowIndex == 0) ? "" : ", ";
+            insertStmtString += valuesPlaceholder_;
+        }
+        insertStmtString += ";";
+
+        return insertStmtString;
+    }
+    const std::tuple<Members Row::*...>& GetMemberList() const
+    {
+        return memberList_;
+    }
+
+    // 같은 컬럼 대응으로 다른 테이블(파티션 등)에 INSERT
+    TableMapping WithTableName(_In_ const std::string& tableName) const
+    {
+        TableMapping tableMapping(*this);
+        tableMapping.insertStmtPrefix_ = "INSERT INTO " + tableName + "(" + columnsName_ + ") VALUES";
+        return tableMapping;
+    }
+
+private:
+    std::string columnsName_;           // c1, c2, ...
+    std::string insertStmtPrefix_;      // INSERT INTO t(c1, c2, ...) VALUES
+    std::string valuesPlaceholder_;     // (?, ?, ...)
+    std::tuple<Members Row::*...> memberList_;
+};
+
+template <typename Row, typename... Members>
+TableMapping<Row, Members...> MakeTableMapping(_In_ const std::string& tableName, _In_ const ColumnMapping<Row, Members>&... columnMappings)
+{
+    return TableMapping<Row, Members...>(tableName, columnMappings...);
+}
+
+/*
+    SQLITE_BUSY(다른 연결이 잠금 보유), SQLITE_LOCKED(공유 캐시 잠금)를 받았을 때 대기 방식
+
+    kSleepPolling: 고정 간격(pollingIntervalMilliseconds)으로 재시도 (이전 동작)
+    kExponentialBackoff: initialBackoffMilliseconds부터 2배씩 maxBackoffMilliseconds까지 늘리며 재시도, 대기 시간에 지터 적용
+    kBusyHandler: sqlite3_busy_handler로 SQLite 내부에서 재시도 (잠금을 기다리는 동안 명령문을 다시 실행하지 않음)
+    kUnlockNotify: SQLITE_LOCKED는 sqlite3_unlock_notify로 잠금 해제 시점에 깨어나서 재시도
+                   SQLITE_ENABLE_UNLOCK_NOTIFY로 빌드되지 않았거나 SQLITE_BUSY인 경우 kExponentialBackoff와 동일
+*/
+enum class BusyStrategy
+{
+    kSleepPolling,
+    kExponentialBackoff,
+    kBusyHandler,
+    kUnlockNotify
+};
+
+struct BusyOptions
+{
+    BusyOptions()
+    {
+        strategy = BusyStrategy::kExponentialBackoff;
+        timeOutMilliseconds = kBusyTimeOutSecond * 1000;
+        initialBackoffMilliseconds = 1;
+        maxBackoffMilliseconds = 100;
+        pollingIntervalMilliseconds = 500;
+    };
+
+    BusyStrategy strategy;
+    uint32_t timeOutMilliseconds;           // 첫 SQLITE_BUSY 이후 이 시간이 지나면 SQLITE_BUSY 리턴
+    uint32_t initialBackoffMilliseconds;
+    uint32_t maxBackoffMilliseconds;
+    uint32_t pollingIntervalMilliseconds;   // kSleepPolling 전용
+};
+
+/*
+    SQLITE_BUSY, SQLITE_LOCKED로 대기한 시간 분포
+    bucketList[0]은 1ms 미만, bucketList[n]은 2^(n-1)ms 이상 2^n ms 미만, 마지막 버킷은 2^14ms 이상
+*/
+struct BusyWaitHistogram
+{
+    BusyWaitHistogram()
+    {
+        for (auto& bucketListEntry : bucketList)
+        {
+            bucketListEntry = 0;
+        }
+        waitCount = 0;
+        timeOutCount = 0;
+        totalWaitMilliseconds = 0;
+        maxWaitMilliseconds = 0;
+    };
+
+    uint64_t bucketList[kBusyWaitHistogramBucketNumber];
+    uint64_t waitCount;
+    uint64_t timeOutCount;          // 대기 시간을 초과해서 SQLITE_BUSY, SQLITE_LOCKED를 리턴한 횟수
+    uint64_t totalWaitMilliseconds;
+    uint64_t maxWaitMilliseconds;
+};
+
+// CreateDatabase에서 적용하는 PRAGMA 값 (kUnchanged는 PRAGMA를 실행하지 않음)
+enum class JournalMode
+{
+    kUnchanged,
+    kDelete,
+    kTruncate,
+    kPersist,
+    kMemory,
+    kWal,
+    kOff
+};
+
+enum class SynchronousMode
+{
+    kUnchanged,
+    kOff,
+    kNormal,
+    kFull,
+    kExtra
+};
+
+// NONE에서 FULL, INCREMENTAL로 바꾸려면 테이블이 생성되기 전이거나 VACUUM이 필요 (FULL <-> INCREMENTAL은 언제든 가능)
+enum class AutoVacuumMode
+{
+    kUnchanged,
+    kNone,
+    kFull,
+    kIncremental
+};
+
+enum class TempStore
+{
+    kUnchanged,
+    kFile,
+    kMemory
+};
+
+enum class LockingMode
+{
+    kUnchanged,
+    kNormal,
+    kExclusive
+};
+
+enum class OpenProfile
+{
+    kNone,          // 아무것도 변경하지 않음
+    kIngest,        // 대량 INSERT (WAL, synchronous=NORMAL, 큰 캐시, Checkpoint 간격 확대)
+    kAnalytics,     // 대량 SELECT (WAL, 아주 큰 캐시와 mmap)
+    kLowMemory      // 메모리 사용 최소화 (작은 캐시, mmap 사용 안 함, 임시 데이터는 파일)
+};
+
+struct OpenOptions
+{
+    explicit OpenOptions(_In_opt_ OpenProfile openProfile = OpenProfile::kNone)
+    {
+        journalMode = JournalMode::kUnchanged;
+        synchronousMode = SynchronousMode::kUnchanged;
+        cacheSize = 0;
+        mmapSize = -1;
+        pageSize = 0;
+        autoVacuumMode = AutoVacuumMode::kUnchanged;
+        tempStore = TempStore::kUnchanged;
+        walAutoCheckpoint = -1;
+        lockingMode = LockingMode::kUnchanged;
+        overrideBusyOptions = false;
+
+        switch (openProfile)
+        {
+        case OpenProfile::kIngest:
+            journalMode = JournalMode::kWal;
+            synchronousMode = SynchronousMode::kNormal;
+            cacheSize = -64 * 1024;
+            mmapSize = 256 * 1024 * 1024;
+            tempStore = TempStore::kMemory;
+            walAutoCheckpoint = 4000;
+            overrideBusyOptions = true;
+            busyOptions.strategy = BusyStrategy::kExponentialBackoff;
+            break;
+
+        case OpenProfile::kAnalytics:
+            journalMode = JournalMode::kWal;
+            synchronousMode = SynchronousMode::kNormal;
+            cacheSize = -256 * 1024;
+            mmapSize = 1024 * 1024 * 1024;
+            tempStore = TempStore::kMemory;
+            break;
+
+        case OpenProfile::kLowMemory:
+            journalMode = JournalMode::kWal;
+            synchronousMode = SynchronousMode::kNormal;
+            cacheSize = -2 * 1024;
+            mmapSize = 0;
+            tempStore = TempStore::kFile;
+            walAutoCheckpoint = 1000;
+            break;
+
+        default:
+            break;
+        }
+    };
+
+    JournalMode journalMode;            // 읽기 전용 연결에는 적용하지 않음
+    SynchronousMode synchronousMode;
+    int64_t cacheSize;                  // 0이면 변경 안 함, 양수는 페이지 수, 음수는 KiB
+    int64_t mmapSize;                   // 음수이면 변경 안 함, 0이면 mmap 사용 안 함
+    uint32_t pageSize;                  // 0이면 변경 안 함, 새로 만드는 Database에만 적용 (읽기 전용 연결에는 적용하지 않음)
+    AutoVacuumMode autoVacuumMode;      // 읽기 전용 연결에는 적용하지 않음
+    TempStore tempStore;
+    int32_t walAutoCheckpoint;          // 음수이면 변경 안 함, 0이면 자동 Checkpoint 사용 안 함
+    LockingMode lockingMode;
+    bool overrideBusyOptions;           // true이면 busyOptions로 SetBusyOptions
+    BusyOptions busyOptions;
+};
+
+// SetPragma, GetPragma로 사용할 수 있는 PRAGMA
+enum class Pragma
+{
+    kApplicationId,
+    kAutoVacuum,
+    kBusyTimeout,
+    kCacheSize,
+    kCacheSpill,
+    kDataVersion,
+    kForeignKeys,
+    kFreelistCount,
+    kIncrementalVacuum,     // SetPragma 전용 (값은 freelist에서 제거할 최대 페이지 수, 0이면 전체 제거)
+    kJournalMode,
+    kJournalSizeLimit,
+    kLockingMode,
+    kMaxPageCount,
+    kMmapSize,
+    kPageCount,
+    kPageSize,
+    kQueryOnly,
+    kRecursiveTriggers,
+    kSchemaVersion,
+    kSecureDelete,
+    kSynchronous,
+    kTempStore,
+    kThreads,
+    kUserVersion,
+    kWalAutoCheckpoint,
+
+    kPragmaNumber
+};
+
+/*
+    SetPragma, SetPragmaList에 전달하는 PRAGMA와 값
+    PRAGMA 값은 Bind할 수 없으므로 생성 시점에 SQL 리터럴로 변환해서 보관
+
+    정수형(bool 포함) -> 10진수
+    float, double -> 유효숫자 17자리 실수
+    const char*, std::string, StmtText -> 작은따옴표 문자열 (작은따옴표는 두 번 반복)
+    StmtBlob -> X'16진수'
+*/
+struct PragmaSetting
+{
+    template <typename Value>
+    PragmaSetting(_In_ Pragma pragmaValue, _In_ const Value& value)
+    {
+        pragma = pragmaValue;
+        valueLiteral = ToSqlLiteral(value);
+    };
+
+    template <typename Integer>
+    static typename std::enable_if<std::is_integral<Integer>::value, std::string>::type ToSqlLiteral(_In_ Integer value)
+    {
+        return std::to_string(value);
+    }
+    static std::string ToSqlLiteral(_In_ double value);
+    static std::string ToSqlLiteral(_In_ const std::string::traits_type::char_type* value);
+    static std::string ToSqlLiteral(_In_ const std::string& value);
+    static std::string ToSqlLiteral(_In_ const StmtText& value);
+    static std::string ToSqlLiteral(_In_ const StmtBlob& value);
+
+    Pragma pragma;
+    std::string valueLiteral;
 };
 
 struct StmtInfo
@@ -147,19 +591,336 @@ struct StmtInfo
     StmtInfo()
     {
         stmt = nullptr;
+        stmtStringHash = 0;
         columnCount = 0;
         bindParameterCount = 0;
     };
 
-    mutable sqlite3_stmt* stmt; // ܺ ̺귯  mutable 
+    mutable sqlite3_stmt* stmt; // 외부 라이브러리 변수라서 mutable 선언
     std::string stmtString;
+    uint64_t stmtStringHash;    // stmtString 해시 값 (FindPreparedStmt 검색 키)
     StmtType stmtType;
     uint32_t columnCount;
     uint32_t bindParameterCount;
+    mutable BusyWaitHistogram busyWaitHistogram;    // 해당 명령문의 Step 대기 시간
+};
+
+/*
+    PrepareStmt로 등록된 명령문 핸들
+    ClearPreparedStmt, FinalizePreparedStmt, CloseDatabase 이후에는 generation이 달라지므로 kNotFound로 검출됨
+*/
+struct StmtHandle
+{
+    StmtHandle()
+    {
+        index = 0;
+        generation = 0;
+    };
+
+    uint32_t index;         // 내부 슬롯 Index
+    uint32_t generation;    // 0이면 유효하지 않은 핸들
+};
+
+struct StmtCacheStatistics
+{
+    StmtCacheStatistics()
+    {
+        hitCount = 0;
+        missCount = 0;
+        evictionCount = 0;
+        cachedStmtCount = 0;
+    };
+
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t evictionCount;
+    uint32_t cachedStmtCount;
+};
+
+// CreateDatabase 테이블 검증 횟수 (프로세스 전체 누적)
+struct SchemaVerifyStatistics
+{
+    SchemaVerifyStatistics()
+    {
+        verifyCount = 0;
+        cacheHitCount = 0;
+        verifyPrepareCount = 0;
+    };
+
+    uint64_t verifyCount;           // 검증 명령문 목록이 있는 검증 요청 수
+    uint64_t cacheHitCount;         // 스키마 상태가 같아서 Prepare 없이 성공한 수
+    uint64_t verifyPrepareCount;    // 검증 명령문 Prepare 수
 };
 
 typedef std::function<CallbackErrors(const StmtInfo&)> StepCallbackFunc;
 
+class SqliteManager;
+
+/*
+    ResultCursor가 현재 가리키는 행
+    StmtText, StmtBlob으로 읽은 값은 복사본이 아니므로 다음 Step 전까지만 유효 (보관하려면 std::string으로 읽어야 됨)
+*/
+class ResultRow
+{
+public:
+    explicit ResultRow(_In_ sqlite3_stmt* stmt) : stmt_(stmt)
+    {
+
+    }
+
+    uint32_t GetColumnCount() const
+    {
+        return static_cast<uint32_t>(sqlite3_column_count(stmt_));
+    }
+    StmtDataType GetColumnDataType(_In_ uint32_t columnIndex) const
+    {
+        return static_cast<StmtDataType>(sqlite3_column_type(stmt_, static_cast<int>(columnIndex)));
+    }
+    bool IsNull(_In_ uint32_t columnIndex) const
+    {
+        return GetColumnDataType(columnIndex) == StmtDataType::kNull;
+    }
+
+    // 정수형, float, double, StmtText, StmtBlob, std::string
+    template <typename Column>
+    Column Get(_In_ uint32_t columnIndex) const
+    {
+        Column column;
+        GetColumn_(stmt_, static_cast<int>(columnIndex), column);
+        return column;
+    }
+
+    // 0번 컬럼부터 순서대로 읽어서 std::tuple로 반환 (컬럼마다 타입 분기는 컴파일 타임에 결정)
+    template <typename... Columns>
+    std::tuple<Columns...> GetTuple() const
+    {
+        return GetTuple_<Columns...>(std::index_sequence_for<Columns...>());
+    }
+
+private:
+    template <typename... Columns, size_t... ColumnIndexes>
+    std::tuple<Columns...> GetTuple_(std::index_sequence<ColumnIndexes...>) const
+    {
+        return std::tuple<Columns...>(Get<Columns>(static_cast<uint32_t>(ColumnIndexes))...);
+    }
+
+    template <typename Integer>
+    static typename std::enable_if<std::is_integral<Integer>::value>::type GetColumn_(_In_ sqlite3_stmt* stmt, _In_ int columnIndex, _Out_ Integer& column)
+    {
+        column = static_cast<Integer>(sqlite3_column_int64(stmt, columnIndex));
+    }
+    template <typename Float>
+    static typename std::enable_if<std::is_floating_point<Float>::value>::type GetColumn_(_In_ sqlite3_stmt* stmt, _In_ int columnIndex, _Out_ Float& column)
+    {
+        column = static_cast<Float>(sqlite3_column_double(stmt, columnIndex));
+    }
+    static void GetColumn_(_In_ sqlite3_stmt* stmt, _In_ int columnIndex, _Out_ StmtText& column)
+    {
+        // sqlite3_column_bytes는 sqlite3_column_text 이후에 호출해야 변환된 길이가 리턴됨
+        column.data = reinterpret_cast<const std::string::traits_type::char_type*>(sqlite3_column_text(stmt, columnIndex));
+        column.byteSize = static_cast<uint32_t>(sqlite3_column_bytes(stmt, columnIndex));
+    }
+    static void GetColumn_(_In_ sqlite3_stmt* stmt, _In_ int columnIndex, _Out_ StmtBlob& column)
+    {
+        column.data = sqlite3_column_blob(stmt, columnIndex);
+        column.byteSize = static_cast<uint32_t>(sqlite3_column_bytes(stmt, columnIndex));
+    }
+    static void GetColumn_(_In_ sqlite3_stmt* stmt, _In_ int columnIndex, _Out_ std::string& column)
+    {
+        StmtText text;
+
+        GetColumn_(stmt, columnIndex, text);
+        if (text.data == nullptr)
+        {
+            column.clear();
+        }
+        else
+        {
+            column.assign(text.data, text.byteSize);
+        }
+    }
+
+private:
+    sqlite3_stmt* stmt_;
+};
+
+/*
+    ResultCursor::FetchColumnBatch로 채워지는 컬럼 단위 버퍼
+    호출자가 columnIndex, dataType을 지정하고 Fetch마다 내용만 다시 채우므로 용량은 재사용됨
+
+    kInteger -> integerList, kFloat -> floatList
+    kText, kBlob -> arena에 연속으로 저장, n번째 행은 arena[offsetList[n]] ~ arena[offsetList[n + 1]] (offsetList 개수는 행 개수 + 1)
+    nullBitmap은 행마다 1bit (1이면 NULL), NULL인 행도 값 자리(0, 길이 0)는 채워짐
+*/
+struct ColumnBuffer
+{
+    ColumnBuffer()
+    {
+        columnIndex = 0;
+        dataType = StmtDataType::kInteger;
+    };
+    ColumnBuffer(_In_ uint32_t bufferColumnIndex, _In_ StmtDataType bufferDataType)
+    {
+        columnIndex = bufferColumnIndex;
+        dataType = bufferDataType;
+    };
+
+    bool IsNull(_In_ uint32_t rowIndex) const
+    {
+        return (nullBitmap[rowIndex / 8] & (1 << (rowIndex % 8))) != 0;
+    }
+
+    uint32_t columnIndex;
+    StmtDataType dataType;
+
+    std::vector<int64_t> integerList;
+    std::vector<double> floatList;
+    std::vector<uint32_t> offsetList;
+    std::vector<std::string::traits_type::char_type> arena;
+    std::vector<uint8_t> nullBitmap;
+};
+
+/*
+    SqliteManager::Query가 리턴하는 결과 커서 (입력 반복자 범위)
+
+    for (auto row : sqliteManager.Query(stmtHandle, beginTimeStamp, endTimeStamp))
+    {
+        int64_t timeStamp = row.Get<int64_t>(1);
+    }
+
+    한 번에 한 행만 유지하므로 결과 크기와 관계없이 메모리 사용량이 일정
+    커서가 소멸될 때 sqlite3_reset, sqlite3_clear_bindings 호출
+    커서가 살아있는 동안 같은 명령문을 ExecStmt, Query로 다시 실행하면 안됨
+*/
+class ResultCursor
+{
+public:
+    class Iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef ResultRow value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const ResultRow* pointer;
+        typedef ResultRow reference;
+
+        Iterator() : resultCursor_(nullptr)
+        {
+
+        }
+        explicit Iterator(_In_ ResultCursor* resultCursor) : resultCursor_(resultCursor)
+        {
+
+        }
+
+        ResultRow operator*() const
+        {
+            return resultCursor_->GetRow();
+        }
+        Iterator& operator++()
+        {
+            if (resultCursor_->Next() == false)
+            {
+                resultCursor_ = nullptr;
+            }
+
+            return *this;
+        }
+        bool operator==(_In_ const Iterator& iterator) const
+        {
+            return resultCursor_ == iterator.resultCursor_;
+        }
+        bool operator!=(_In_ const Iterator& iterator) const
+        {
+            return resultCursor_ != iterator.resultCursor_;
+        }
+
+    private:
+        ResultCursor* resultCursor_;
+    };
+
+public:
+    ResultCursor(_Inout_ ResultCursor&& resultCursor);
+    ~ResultCursor();
+
+    ResultCursor(const ResultCursor&) = delete;
+    ResultCursor& operator=(const ResultCursor&) = delete;
+
+    Iterator begin();
+    Iterator end();
+
+    // 다음 행으로 이동, 더 이상 행이 없거나 실패하면 false (결과는 GetStatus로 확인)
+    bool Next();
+    ResultRow GetRow() const;
+
+    /*
+        최대 maxRowCount개 행을 읽어서 columnBufferList의 각 컬럼 버퍼에 채움
+        행을 하나 이상 읽으면 kSuccess, 더 읽을 행이 없으면 kNoResult, 실패 시 kUnsuccess
+
+        while (resultCursor.FetchColumnBatch(1024, columnBufferList, fetchedRowCount) == Errors::kSuccess)
+        {
+            // columnBufferList[n].integerList.data() 등 연속 메모리로 처리
+        }
+    */
+    Errors FetchColumnBatch(
+        _In_ uint32_t maxRowCount,
+        _Inout_ std::vector<ColumnBuffer>& columnBufferList,
+        _Out_ uint32_t& fetchedRowCount
+    );
+
+    // 진행 중이거나 모두 읽은 경우 kSuccess, 행이 하나도 없는 SELECT는 kNoResult, 실패 시 kUnsuccess, kNotFound
+    Errors GetStatus() const;
+
+private:
+    friend class SqliteManager;
+
+    ResultCursor(_In_ SqliteManager* sqliteManager, _In_opt_ const StmtInfo* stmtInfo, _In_ Errors status);
+
+    void AppendColumnBuffer_(_Inout_ ColumnBuffer& columnBuffer, _In_ uint32_t rowIndex);
+
+private:
+    SqliteManager* sqliteManager_;
+    const StmtInfo* stmtInfo_;
+    Errors status_;
+    uint64_t stepCount_;
+    bool finished_;
+};
+
+// std::function을 거치지 않도록 람다 타입을 그대로 보관 (ExecStmt_ 등 반복 실행 경로에서 heap 할당 방지)
+template <typename RAIIFunc>
+class RAIIRegisterImpl
+{
+private:
+    RAIIFunc raiiFunction_;
+    bool registered_;
+
+public:
+    explicit RAIIRegisterImpl(RAIIFunc&& raiiFunc) : raiiFunction_(std::move(raiiFunc)), registered_(true)
+    {
+
+    }
+    RAIIRegisterImpl(RAIIRegisterImpl&& raiiRegister) : raiiFunction_(std::move(raiiRegister.raiiFunction_)), registered_(raiiRegister.registered_)
+    {
+        raiiRegister.registered_ = false;
+    }
+    ~RAIIRegisterImpl()
+    {
+        if (registered_ == true)
+        {
+            raiiFunction_();
+        }
+    }
+
+    RAIIRegisterImpl(const RAIIRegisterImpl&) = delete;
+    RAIIRegisterImpl& operator=(const RAIIRegisterImpl&) = delete;
+};
+
+template <typename RAIIFunc>
+RAIIRegisterImpl<RAIIFunc> RAIIRegister(RAIIFunc raiiFunc)
+{
+    return RAIIRegisterImpl<RAIIFunc>(std::move(raiiFunc));
+}
+
 class SqliteManager
 {
 public:
@@ -173,25 +934,29 @@ public:
         _In_opt_ FPDataChangeNotificationCallback dataChangeNotificationCallback,
         _In_opt_ void* dataChangeNotificationCallbackUserContext,
         _In_ const std::vector<std::string>& verifyTableStmtStringList,
-        _In_opt_ const std::vector<std::string>* createTableStmtStringList = nullptr
+        _In_opt_ const std::vector<std::string>* createTableStmtStringList = nullptr,
+        _In_opt_ const OpenOptions* openOptions = nullptr
     );
 
-    Errors CloseDatabase(_In_opt_ bool deleteDatabase = false, _In_opt_ bool resetPreparedStmtIndex = false);
+    Errors CloseDatabase(_In_opt_ bool deleteDatabase = false);
 
-    Errors PrepareStmt(_In_ const std::string& stmtString, _In_opt_ uint32_t prepareFlags = SQLITE_PREPARE_PERSISTENT, _Out_opt_ uint32_t* preparedStmtIndex = nullptr);
-    void ClearPreparedStmt(_In_opt_ bool resetPreparedStmtIndex = false);
+    Errors PrepareStmt(_In_ const std::string& stmtString, _In_opt_ uint32_t prepareFlags = SQLITE_PREPARE_PERSISTENT, _Out_opt_ StmtHandle* preparedStmtHandle = nullptr);
+    Errors FinalizePreparedStmt(_In_ StmtHandle preparedStmtHandle);
+    // stmtStringPrefix로 시작하는 명령문 모두 제거 (DROP된 테이블의 BulkInsert 명령문 정리 등)
+    void FinalizePreparedStmt(_In_ const std::string& stmtStringPrefix);
+    void ClearPreparedStmt();
 
-    // preparedStmtInfo ϵǴ StmtInfo ּ  vector  ּ̹Ƿ preparedStmtInfoList_      .
-    // , ϰ Ϸ Ϸ  س ° .
+    // preparedStmtInfo에 리턴되는 StmtInfo 주소는 PrepareStmt로 다른 명령문이 추가되어도 유지됨.
+    // 해당 명령문이 FinalizePreparedStmt, ClearPreparedStmt로 제거되기 전까지 유효.
     Errors FindPreparedStmt(_In_ const std::string& preparedStmtString, _Out_ const StmtInfo*& preparedStmtInfo);
-    Errors FindPreparedStmt(_In_ uint32_t preparedStmtIndex, _Out_ const StmtInfo*& preparedStmtInfo);
+    Errors FindPreparedStmt(_In_ StmtHandle preparedStmtHandle, _Out_ const StmtInfo*& preparedStmtInfo);
 
     /*
-        ɹ Preparedϰ ͸ Bindؼ óϴ 
-        1. Insert ؾ  Ͱ   óϱⰡ 
-        2.  ó    ʿ䰡   ӵ 
-        3. Binding ϰԵǸ ڿ ǥ  ʰ ǹǷ SQL Injection   پ
-        4. ū ڿ  мϰų   ʿ䰡 Ƿ ӵ 
+        명령문을 Prepared하고 데이터를 Bind해서 처리하는 이유
+        1. Insert 해야 될 데이터가 유동적인 경우 처리하기가 편함
+        2. 내부 처리 구문으로 재컴파일 할 필요가 없기 때문에 속도가 빠름
+        3. Binding을 하게되면 문자열에 따옴표를 사용하지 않게 되므로 SQL Injection 공격의 위험이 줄어듦
+        4. 큰 문자열을 구문 분석하거나 복사 할 필요가 없으므로 속도가 빠름
     */
     Errors ExecStmt(
         _In_ const std::string& stmtString,
@@ -199,56 +964,409 @@ public:
         _In_opt_ StepCallbackFunc* stmtStepCallback = nullptr
     );
     Errors ExecStmt(
-        _In_ uint32_t preparedStmtIndex,
+        _In_ StmtHandle preparedStmtHandle,
         _In_opt_ const std::vector<StmtBindParameterInfo>* stmtBindParameterInfoList = nullptr,
         _In_opt_ StepCallbackFunc* stmtStepCallback = nullptr
     );
 
+    // 반복 실행 경로용 오버로드, std::array 등 호출자 스택 배열을 그대로 전달하면 호출마다 heap 할당이 발생하지 않음
+    Errors ExecStmt(
+        _In_ StmtHandle preparedStmtHandle,
+        _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+        _In_ uint32_t stmtBindParameterInfoCount,
+        _In_opt_ StepCallbackFunc* stmtStepCallback = nullptr
+    );
+
+    /*
+        StepCallbackFunc(std::function) 대신 람다, 함수 객체 등 임의의 호출 가능 객체를 받는 오버로드
+        콜백이 Step 루프에 인라인되므로 대량의 행을 읽는 SELECT에서 행마다 발생하는 간접 호출 비용이 없음
+        콜백 형식과 kContinue, kStop, kFail 처리는 StepCallbackFunc와 동일
+    */
+    template <typename StepCallback>
+    Errors ExecStmt(
+        _In_ StmtHandle preparedStmtHandle,
+        _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+        _In_ uint32_t stmtBindParameterInfoCount,
+        _In_ StepCallback&& stmtStepCallback
+    );
+
+    /*
+        파라미터 타입에 맞는 sqlite3_bind_XXX 함수를 컴파일 타임에 선택해서 Bind 후 실행
+        StmtBindParameterInfo 목록을 만들 필요가 없고 실행 시 타입 분기도 없음
+
+        정수형(bool 포함) -> sqlite3_bind_int64
+        float, double -> sqlite3_bind_double
+        const char*, std::string, StmtText -> sqlite3_bind_text (SQLITE_STATIC)
+        StmtBlob -> sqlite3_bind_blob (SQLITE_STATIC)
+        nullptr -> sqlite3_bind_null
+
+        Bind는 실행이 끝나면 해제되므로 파라미터를 복사하지 않음
+        파라미터 개수가 bindParameterCount와 다르면 kUnsuccess
+        stmtStepCallback은 nullptr, StepCallbackFunc*, 람다 모두 가능
+    */
+    template <typename StepCallback, typename... Params>
+    Errors ExecStmtWithParameters(
+        _In_ StmtHandle preparedStmtHandle,
+        _In_opt_ StepCallback&& stmtStepCallback,
+        _In_ const Params&... params
+    );
+
+    /*
+        콜백 대신 반복문으로 결과를 읽는 커서 리턴 (파라미터 Bind 규칙은 ExecStmtWithParameters와 동일)
+        텍스트, BLOB 파라미터는 커서보다 먼저 소멸될 수 있으므로 SQLITE_TRANSIENT로 복사해서 Bind
+        실패 시 비어있는 커서를 리턴하며 원인은 ResultCursor::GetStatus로 확인
+    */
+    template <typename... Params>
+    ResultCursor Query(
+        _In_ StmtHandle preparedStmtHandle,
+        _In_ const Params&... params
+    );
+
+    /*
+        구조체 배열을 tableMapping에 따라 INSERT (행마다 StmtBindParameterInfo 목록을 만들지 않고 멤버를 바로 Bind)
+        INSERT 명령문은 처음 호출 시 PrepareStmt로 등록하고 이후 호출에서 재사용
+
+        chunkRowCount 행마다 BEGIN IMMEDIATE ~ COMMIT, valuesRowCount 행마다 Step (BulkInsertOptions 참고)
+        실패하면 해당 청크는 ROLLBACK되고 insertedRowCount에는 Commit된 행 수가 리턴됨
+        이미 트랜잭션 안에서 호출하면 트랜잭션을 열지 않고 호출자의 트랜잭션에 포함
+        (insertedRowCount는 실행된 행 수, 실패 시 ROLLBACK 여부는 호출자가 결정)
+    */
+    template <typename Row, typename... Members>
+    Errors BulkInsert(
+        _In_ const TableMapping<Row, Members...>& tableMapping,
+        _In_reads_(rowCount) const Row* rowList,
+        _In_ uint32_t rowCount,
+        _In_opt_ const BulkInsertOptions& bulkInsertOptions = BulkInsertOptions(),
+        _Out_opt_ uint32_t* insertedRowCount = nullptr
+    );
+    template <typename Row, typename... Members>
+    Errors BulkInsert(
+        _In_ const TableMapping<Row, Members...>& tableMapping,
+        _In_ const std::vector<Row>& rowList,
+        _In_opt_ const BulkInsertOptions& bulkInsertOptions = BulkInsertOptions(),
+        _Out_opt_ uint32_t* insertedRowCount = nullptr
+    );
+
+    /*
+        PrepareStmt로 등록되지 않은 SELECT, INSERT, UPDATE, DELETE 명령문을 ExecStmt(stmtString)로 실행하면
+        Prepare 결과를 LRU 캐시에 보관하고 같은 문자열이 다시 실행될 때 재사용
+        stmtCacheSize가 0이면 캐시를 사용하지 않음
+    */
+    void SetStmtCacheSize(_In_ uint32_t stmtCacheSize);
+    void ClearStmtCache();
+    void GetStmtCacheStatistics(_Out_ StmtCacheStatistics& stmtCacheStatistics);
+
+    // CreateDatabase 전후 언제든 변경 가능 (kBusyHandler는 열려있는 연결에 바로 적용)
+    void SetBusyOptions(_In_ const BusyOptions& busyOptions);
+    void GetBusyOptions(_Out_ BusyOptions& busyOptions);
+
+    // 명령문별 Step 대기 시간, 연결 전체(Prepare 포함) 대기 시간
+    Errors GetBusyWaitHistogram(_In_ StmtHandle preparedStmtHandle, _Out_ BusyWaitHistogram& busyWaitHistogram);
+    void GetBusyWaitHistogram(_Out_ BusyWaitHistogram& busyWaitHistogram);
+
+    // sqlite3_limit 현재 값 (SQLITE_LIMIT_ATTACHED 등, 열려있지 않으면 -1)
+    int GetLimit(_In_ int limitId);
+    // 마지막으로 완료된 INSERT, UPDATE, DELETE가 변경한 행 수 (sqlite3_changes, 열려있지 않으면 0)
+    int GetChanges();
+
+    // 미리 Prepare된 BEGIN (IMMEDIATE), COMMIT, ROLLBACK 실행
+    Errors BeginTransaction(_In_opt_ bool immediate = true);
+    Errors CommitTransaction();
+    Errors RollbackTransaction();
+    bool IsInTransaction();
+
+    /*
+        행마다 호출되는 FPDataChangeNotificationCallback 대신 변경 내역을 트랜잭션 단위로 모아서 COMMIT이 완료된 후 한 번에 전달
+        ROLLBACK된 변경은 전달되지 않음
+        콜백은 COMMIT한 명령문의 Step이 끝난 직후 호출되므로 콜백 안에서 같은 SqliteManager를 사용하면 안 됨
+        nullptr이면 CreateDatabase에 전달한 행 단위 콜백으로 되돌림 (CreateDatabase 전후 언제든 변경 가능)
+
+        SQLite는 명령문 단위 취소(트랜잭션 안에서 실패한 명령문)에 대해서는 ROLLBACK Hook을 호출하지 않으므로
+        실패한 명령문이 취소 전에 변경한 행은 그대로 전달됨
+    */
+    void SetBatchDataChangeNotificationCallback(
+        _In_opt_ FPBatchDataChangeNotificationCallback batchDataChangeNotificationCallback,
+        _In_opt_ void* batchDataChangeNotificationCallbackUserContext
+    );
+
+    // CreateDatabase 테이블 검증 결과 캐시 (프로세스 전체 공유) 비우기
+    static void ClearSchemaFingerprintCache();
+    static void GetSchemaVerifyStatistics(_Out_ SchemaVerifyStatistics& schemaVerifyStatistics);
+
+    // 명령문 문자열의 종류 (앞쪽 공백, 주석, WITH 절은 건너뜀)
+    static StmtType GetStmtType(_In_ const std::string::traits_type::char_type* stmtString);
+
+    // 명령문 문자열 해시 (FindPreparedStmt 검색 키와 같은 값, ConnectionPool 등록 명령문 검색에도 사용)
+    static uint64_t GetStmtStringHash(_In_ const std::string& stmtString);
+
+    /*
+        PRAGMA 설정, 조회 (ExecStmt의 PRAGMA 문자열 조합 경로를 거치지 않음)
+
+        SetPragmaList는 여러 PRAGMA를 한 번의 sqlite3_exec로 실행 (SQLITE_BUSY인 경우 처음부터 재시도)
+        GetPragma의 Value는 정수형, float, double, std::string
+        실행 시점에 값을 읽는 PRAGMA(user_version, page_count 등)는 조회 명령문을 연결마다 한 번만 Prepare해서 재사용하고,
+        Prepare 시점에 값이 결정되는 PRAGMA(cache_size, synchronous 등)는 조회할 때마다 Prepare
+    */
+    template <typename Value>
+    Errors SetPragma(_In_ Pragma pragma, _In_ const Value& value);
+    Errors SetPragmaList(_In_ const std::vector<PragmaSetting>& pragmaSettingList);
+    template <typename Value>
+    Errors GetPragma(_In_ Pragma pragma, _Out_ Value& value);
+
 private:
-    class RAIIRegister
+    friend class ResultCursor;
+
+    struct StmtCacheEntry
     {
-    private:
-        std::function<void()> raiiFunction_;
+        StmtCacheEntry()
+        {
+            stmtStringHash = 0;
+            inUse = false;
+        };
 
-    public:
-        RAIIRegister(std::function<void()> raiiFunc) : raiiFunction_(raiiFunc)
+        std::string stmtString;     // 캐시 키 (ExecStmt에 전달된 문자열)
+        uint64_t stmtStringHash;
+        StmtInfo stmtInfo;
+        bool inUse;                 // ExecStmt_ 실행 중에는 제거 대상에서 제외
+    };
+
+    /*
+        테이블 검증에 성공한 Database의 스키마 상태
+        경로가 같고 모든 값이 같으면 검증 명령문을 다시 Prepare하지 않음
+        schemaHash는 같은 경로에 다른 파일이 만들어진 경우(스키마 버전이 우연히 같은 경우)를 구분하기 위한 sqlite_master 해시
+    */
+    struct SchemaFingerprint
+    {
+        SchemaFingerprint()
         {
+            schemaVersion = 0;
+            userVersion = 0;
+            schemaHash = 0;
+            verifyTableStmtStringListHash = 0;
+        };
 
-        }
-        ~RAIIRegister()
+        bool operator==(const SchemaFingerprint& other) const
         {
-            raiiFunction_();
+            return (schemaVersion == other.schemaVersion) &&
+                (userVersion == other.userVersion) &&
+                (schemaHash == other.schemaHash) &&
+                (verifyTableStmtStringListHash == other.verifyTableStmtStringListHash);
         }
+
+        int64_t schemaVersion;
+        int64_t userVersion;
+        uint64_t schemaHash;
+        uint64_t verifyTableStmtStringListHash;
+    };
+
+    struct SchemaFingerprintCache
+    {
+        std::mutex mutex;
+        std::unordered_map<std::wstring, SchemaFingerprint> schemaFingerprintMap;   // 경로 -> 마지막 검증 성공 상태
+        SchemaVerifyStatistics schemaVerifyStatistics;
+    };
+
+    struct PreparedStmtSlot
+    {
+        PreparedStmtSlot()
+        {
+            generation = 0;
+        };
+
+        StmtInfo stmtInfo;
+        uint32_t generation;        // 0이면 빈 슬롯
     };
 
 private:
     Errors PrepareInternalStmt_();
+    Errors AcquireCachedStmt_(_In_ const std::string& stmtString, _Out_ StmtCacheEntry*& stmtCacheEntry);
+    void TrimStmtCache_();
+
+    // 등록된 명령문이 없으면 PrepareStmt로 등록
+    Errors AcquirePreparedStmt_(_In_ const std::string& stmtString, _Out_ const StmtInfo*& stmtInfo);
 
     void GetStmtInfo_(_Inout_ StmtInfo& stmtInfo);
-    StmtType GetStmtType_(_In_ const std::string::traits_type::char_type* stmtString);
+    static StmtType GetStmtType_(_In_ const std::string::traits_type::char_type* stmtString);
+    static StmtType GetWithStmtType_(_In_ const std::string::traits_type::char_type* stmtString);
+    static const std::string::traits_type::char_type* SkipStmtSpace_(_In_ const std::string::traits_type::char_type* stmtString);
+    static const std::string::traits_type::char_type* ReadStmtKeyword_(_In_ const std::string::traits_type::char_type* stmtString, _Out_ uint32_t& keywordLength);
+    static bool IsStmtKeyword_(_In_ const std::string::traits_type::char_type* keyword, _In_ uint32_t keywordLength, _In_ const char* expectedKeyword);
+    static uint64_t GetStmtStringHash_(_In_ const std::string::traits_type::char_type* stmtString, _In_ size_t stmtStringLength);
     const std::string::traits_type::char_type* GetPreparedStmtString_(_In_ sqlite3_stmt* stmt, _In_opt_ bool withBoundParameters = false);
     void SetPragmaStmtInfo_(_In_ const std::string& stmtString, _Out_ StmtInfo& stmtInfo);
 
-    // stmtStepCallback ݹ鿡 PrepareStmt ޼ ȣ ߻ϸ preparedStmtInfoList_ ּҵ  ٲǷ stmtInfo call-by-value 
+    // preparedStmtSlotList_는 deque이므로 stmtStepCallback 콜백에서 PrepareStmt가 호출되어도 stmtInfo 주소는 유지됨
+    // 단, 콜백에서 실행 중인 명령문을 FinalizePreparedStmt, ClearPreparedStmt로 제거하면 안됨
     Errors ExecStmt_(
-        _In_ const StmtInfo stmtInfo,
-        _In_opt_ const std::vector<StmtBindParameterInfo>* stmtBindParameterInfoList = nullptr,
-        _In_opt_ StepCallbackFunc* stmtStepCallback = nullptr
+        _In_ const StmtInfo& stmtInfo,
+        _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+        _In_ uint32_t stmtBindParameterInfoCount,
+        _In_opt_ StepCallbackFunc* stmtStepCallback
+    );
+
+    // destructorType은 텍스트, BLOB에만 적용 (Query는 Bind 값이 커서보다 먼저 소멸될 수 있으므로 SQLITE_TRANSIENT 사용)
+    template <typename Integer>
+    static typename std::enable_if<std::is_integral<Integer>::value, int>::type BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ Integer parameter,
+        _In_opt_ sqlite3_destructor_type = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_int64(stmt, parameterIndex, static_cast<sqlite3_int64>(parameter));
+    }
+    template <typename Float>
+    static typename std::enable_if<std::is_floating_point<Float>::value, int>::type BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ Float parameter,
+        _In_opt_ sqlite3_destructor_type = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_double(stmt, parameterIndex, static_cast<double>(parameter));
+    }
+    static int BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ const std::string::traits_type::char_type* parameter,
+        _In_opt_ sqlite3_destructor_type destructorType = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_text(stmt, parameterIndex, parameter, -1, destructorType);
+    }
+    static int BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ const std::string& parameter,
+        _In_opt_ sqlite3_destructor_type destructorType = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_text(stmt, parameterIndex, parameter.c_str(), static_cast<int>(parameter.length()), destructorType);
+    }
+    static int BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ const StmtText& parameter,
+        _In_opt_ sqlite3_destructor_type destructorType = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_text(stmt, parameterIndex, parameter.data, parameter.byteSize == 0 ? -1 : static_cast<int>(parameter.byteSize), destructorType);
+    }
+    static int BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ const StmtBlob& parameter,
+        _In_opt_ sqlite3_destructor_type destructorType = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_blob(stmt, parameterIndex, parameter.data, static_cast<int>(parameter.byteSize), destructorType);
+    }
+    static int BindParameter_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int parameterIndex,
+        _In_ std::nullptr_t,
+        _In_opt_ sqlite3_destructor_type = SQLITE_STATIC
+    )
+    {
+        return sqlite3_bind_null(stmt, parameterIndex);
+    }
+
+    // BulkInsert용, 구조체 멤버를 컬럼 순서대로 firstParameterIndex부터 Bind
+    template <typename Row, typename... Members, size_t... ColumnIndexes>
+    static bool BindRow_(
+        _In_ sqlite3_stmt* stmt,
+        _In_ int firstParameterIndex,
+        _In_ const Row& row,
+        _In_ const std::tuple<Members Row::*...>& memberList,
+        _In_ std::index_sequence<ColumnIndexes...>
+    )
+    {
+        const int sqliteStatusList[] = { BindParameter_(stmt, firstParameterIndex + static_cast<int>(ColumnIndexes), row.*std::get<ColumnIndexes>(memberList))... };
+
+        for (const auto& sqliteStatusListEntry : sqliteStatusList)
+        {
+            if (sqliteStatusListEntry != SQLITE_OK)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static CallbackErrors InvokeStepCallback_(_In_opt_ StepCallbackFunc* stmtStepCallback, _In_ const StmtInfo& stmtInfo)
+    {
+        return (stmtStepCallback == nullptr) ? CallbackErrors::kContinue : (*stmtStepCallback)(stmtInfo);
+    }
+    static CallbackErrors InvokeStepCallback_(_In_ std::nullptr_t, _In_ const StmtInfo&)
+    {
+        return CallbackErrors::kContinue;
+    }
+    template <typename StepCallback>
+    static CallbackErrors InvokeStepCallback_(_In_ StepCallback& stmtStepCallback, _In_ const StmtInfo& stmtInfo)
+    {
+        return stmtStepCallback(stmtInfo);
+    }
+
+    // Bind가 끝난 명령문을 SQLITE_DONE까지 Step (sqlite3_reset, sqlite3_clear_bindings는 호출자가 처리)
+    // StepCallback이 람다 등 구체 타입이면 Step 루프 안에 인라인되어 std::function 간접 호출이 없음
+    template <typename StepCallback>
+    Errors StepStmt_(_In_ const StmtInfo& stmtInfo, _In_opt_ StepCallback& stmtStepCallback);
+
+    Errors StmtBindParameter_(
+        _In_ const StmtInfo& stmtInfo,
+        _In_reads_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+        _In_ uint32_t stmtBindParameterInfoCount
+    );
+    Errors PragmaStmtBindParameter_(
+        _In_ const StmtInfo& stmtInfo,
+        _In_reads_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+        _In_ uint32_t stmtBindParameterInfoCount,
+        _Out_ std::string& pragmaStmtString
     );
+    static const char* GetPragmaName_(_In_ Pragma pragma);
+    static bool IsReusablePragmaStmt_(_In_ Pragma pragma);
+    // 성공하면 pragmaStmt는 첫 행을 가리킴 (EndGetPragma_로 정리)
+    Errors BeginGetPragma_(_In_ Pragma pragma, _Out_ sqlite3_stmt*& pragmaStmt);
+    void EndGetPragma_(_In_ Pragma pragma, _In_ sqlite3_stmt* pragmaStmt);
 
-    Errors StmtBindParameter_(_In_ const StmtInfo& stmtInfo, _In_ const std::vector<StmtBindParameterInfo>& stmtBindParameterInfoList);
-    Errors PragmaStmtBindParameter_(_In_ const StmtInfo& stmtInfo, _In_ const std::vector<StmtBindParameterInfo>& stmtBindParameterInfoList, _Out_ std::string& pragmaStmtString);
-    Errors VerifyTable_(_In_ const std::vector<std::string>& verifyTableStmtStringList);
+    Errors VerifyTableWithCache_(_In_ const std::wstring& databasePath, _In_ const std::vector<std::string>& verifyTableStmtStringList);
+    Errors GetSchemaFingerprint_(_In_ const std::vector<std::string>& verifyTableStmtStringList, _Out_ SchemaFingerprint& schemaFingerprint);
+    static SchemaFingerprintCache& GetSchemaFingerprintCache_();
+    Errors VerifyTable_(_In_ const std::vector<std::string>& verifyTableStmtStringList, _Out_ uint32_t& verifyPrepareCount);
 
-    // sqlite3_XXX  Լ
-    int SqliteStep_(sqlite3_stmt* stmt, uint32_t timeOutSecond = kBusyTimeOutSecond);
+    // SQLITE_BUSY, SQLITE_LOCKED 재시도 (sqliteFunction 결과가 잠금 오류가 아니거나 busyOptions_.timeOutMilliseconds가 지날 때까지)
+    // resetStmt가 있으면 SQLITE_LOCKED 대기 후 sqlite3_reset을 호출하고 재시도 (resetStmt가 이미 행을 리턴한 경우엔 재시도하지 않음)
+    template <typename SqliteFunction>
+    int RetryOnBusy_(_In_ SqliteFunction&& sqliteFunction, _In_opt_ sqlite3_stmt* resetStmt, _Inout_opt_ BusyWaitHistogram* stmtBusyWaitHistogram);
+    bool WaitBusy_(_In_ int sqliteStatus, _In_ uint32_t retryCount, _In_ std::chrono::steady_clock::time_point busyBeginTime);
+#ifdef SQLITE_ENABLE_UNLOCK_NOTIFY
+    bool WaitUnlockNotify_(_In_ std::chrono::steady_clock::time_point busyBeginTime);
+    static void UnlockNotifyCallback_(void** userContextList, int userContextCount);
+#endif
+    void ApplyBusyHandler_();
+    // 기존 Database는 테이블 검증 후, 새 Database는 테이블 생성 전에 실행
+    Errors ApplyOpenOptions_(_In_opt_ const OpenOptions* openOptions, _In_ DesiredAccess desiredAccess);
+    static int BusyHandler_(void* userContext, int invokeCount);
+    static uint32_t GetBackoffMilliseconds_(_In_ const BusyOptions& busyOptions, _In_ uint32_t retryCount, _Inout_ std::minstd_rand& random);
+    static void RecordBusyWait_(_Inout_ BusyWaitHistogram& busyWaitHistogram, _In_ uint64_t waitMilliseconds, _In_ bool timedOut);
+
+    // 행 단위, 트랜잭션 단위 중 설정된 방식으로 update, commit, rollback Hook 등록
+    void ApplyDataChangeHook_();
+    static void BatchUpdateHook_(void* userContext, int actionCode, char const* dbName, char const* tableName, sqlite_int64 rowid);
+    static int CommitHook_(void* userContext);
+    static void RollbackHook_(void* userContext);
+    const char* InternDataChangeName_(_In_ const char* name);
+    void DeliverDataChange_(_In_ int sqliteStatus);
+
+    // sqlite3_XXX 랩핑 함수
+    int SqliteStep_(const StmtInfo& stmtInfo);
     int SqlitePrepareV2_(
         sqlite3* db,
         const char* zSql,
         int nBytes,
         sqlite3_stmt** ppStmt,
-        const char** pzTail,
-        uint32_t timeOutSecond = kBusyTimeOutSecond
+        const char** pzTail
     );
     int SqlitePrepareV3_(
         sqlite3* db,
@@ -256,8 +1374,7 @@ private:
         int nBytes,
         unsigned int prepFlags,
         sqlite3_stmt** ppStmt,
-        const char** pzTail,
-        uint32_t timeOutSecond = kBusyTimeOutSecond
+        const char** pzTail
     );
     void SqliteUpdateHook_(
         sqlite3* db,
@@ -268,9 +1385,457 @@ private:
 private:
     std::wstring databasePath_;
     sqlite3* database_;
+    sqlite3_stmt* schemaFingerprintStmt_;   // 연결마다 한 번만 Prepare (CloseDatabase에서 Finalize)
+    sqlite3_stmt* pragmaStmtList_[static_cast<uint32_t>(Pragma::kPragmaNumber)];   // IsReusablePragmaStmt_인 PRAGMA의 조회 명령문
+
+    // 슬롯 주소가 바뀌지 않도록 deque 사용, 제거된 슬롯은 freePreparedStmtSlotIndexList_로 재사용
+    std::deque<PreparedStmtSlot> preparedStmtSlotList_;
+    std::vector<uint32_t> freePreparedStmtSlotIndexList_;
+    uint32_t preparedStmtGeneration_;   // 핸들 발급 시마다 증가 (CloseDatabase 이후에도 초기화하지 않음)
+
+    // stmtStringHash -> preparedStmtSlotList_ Index (해시 충돌 시 같은 키에 여러 Index가 존재)
+    std::unordered_multimap<uint64_t, uint32_t> preparedStmtIndexMap_;
+
+    StmtHandle internalStmtHandleList_[static_cast<uint32_t>(StmtIndex::kBasicStmtNumber)];
+
+    // ExecStmt(stmtString) 자동 Prepare 캐시 (앞쪽이 가장 최근에 사용된 항목)
+    std::list<StmtCacheEntry> stmtCacheList_;
+    std::unordered_multimap<uint64_t, std::list<StmtCacheEntry>::iterator> stmtCacheIndexMap_;
+    uint32_t stmtCacheSize_;
+    StmtCacheStatistics stmtCacheStatistics_;
+
+    BusyOptions busyOptions_;
+    BusyWaitHistogram busyWaitHistogram_;   // 연결 전체 (Prepare 대기 포함)
+    std::minstd_rand busyBackoffRandom_;    // 백오프 지터용
+
+    // kBusyHandler인 경우 BusyHandler_에서 기록 (RetryOnBusy_에서 대기 시간 계산 후 초기화)
+    bool busyHandlerInvoked_;
+    std::chrono::steady_clock::time_point busyHandlerBeginTime_;
 
-    std::vector<StmtInfo> preparedStmtInfoList_;
-    std::vector<uint32_t*> preparedStmtIndexPointerList_;
+    FPDataChangeNotificationCallback dataChangeNotificationCallback_;
+    void* dataChangeNotificationCallbackUserContext_;
+    FPBatchDataChangeNotificationCallback batchDataChangeNotificationCallback_;
+    void* batchDataChangeNotificationCallbackUserContext_;
+
+    // 진행 중인 트랜잭션의 변경 범위, 테이블별 마지막 범위 Index (범위 병합용)
+    std::vector<DataChangeRange> pendingDataChangeRangeList_;
+    std::vector<uint32_t> openDataChangeRangeIndexList_;
+    // COMMIT Hook이 호출된 후 COMMIT 완료를 기다리는 변경 범위
+    std::vector<DataChangeRange> committedDataChangeRangeList_;
+    // DataChangeRange의 dbName, tableName이 가리키는 문자열 (주소가 바뀌지 않도록 list 사용)
+    std::list<std::string> dataChangeNameList_;
 };
 
+template <typename Value>
+Errors SqliteManager::SetPragma(
+    _In_ Pragma pragma,
+    _In_ const Value& value
+)
+{
+    return SetPragmaList(std::vector<PragmaSetting>(1, PragmaSetting(pragma, value)));
+}
+
+template <typename Value>
+Errors SqliteManager::GetPragma(
+    _In_ Pragma pragma,
+    _Out_ Value& value
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    sqlite3_stmt* pragmaStmt = nullptr;
+
+    retValue = BeginGetPragma_(pragma, pragmaStmt);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    value = ResultRow(pragmaStmt).Get<Value>(0);
+    EndGetPragma_(pragma, pragmaStmt);
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+template <typename StepCallback>
+Errors SqliteManager::ExecStmt(
+    _In_ StmtHandle preparedStmtHandle,
+    _In_reads_opt_(stmtBindParameterInfoCount) const StmtBindParameterInfo* stmtBindParameterInfoList,
+    _In_ uint32_t stmtBindParameterInfoCount,
+    _In_ StepCallback&& stmtStepCallback
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const StmtInfo* stmtInfo = nullptr;
+
+    if (database_ == nullptr)
+    {
+        return retValue;
+    }
+
+    retValue = FindPreparedStmt(preparedStmtHandle, stmtInfo);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    auto raii = RAIIRegister([&]
+        {
+            sqlite3_clear_bindings(stmtInfo->stmt);
+            sqlite3_reset(stmtInfo->stmt);
+        });
+
+    // PrepareStmt에는 Pragma 명령문이 등록되지 않으므로 PragmaStmtBindParameter_ 처리는 필요 없음
+    if (stmtInfo->bindParameterCount != 0)
+    {
+        if ((stmtBindParameterInfoList == nullptr) || (stmtInfo->bindParameterCount != stmtBindParameterInfoCount))
+        {
+            retValue = Errors::kUnsuccess;
+            return retValue;
+        }
+
+        retValue = StmtBindParameter_(*stmtInfo, stmtBindParameterInfoList, stmtBindParameterInfoCount);
+        if (retValue != Errors::kSuccess)
+        {
+            return retValue;
+        }
+    }
+
+    return StepStmt_(*stmtInfo, stmtStepCallback);
+}
+
+template <typename StepCallback, typename... Params>
+Errors SqliteManager::ExecStmtWithParameters(
+    _In_ StmtHandle preparedStmtHandle,
+    _In_opt_ StepCallback&& stmtStepCallback,
+    _In_ const Params&... params
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const StmtInfo* stmtInfo = nullptr;
+
+    if (database_ == nullptr)
+    {
+        return retValue;
+    }
+
+    retValue = FindPreparedStmt(preparedStmtHandle, stmtInfo);
+    if (retValue != Errors::kSuccess)
+    {
+        return retValue;
+    }
+
+    // SQL 문자열은 실행 시 결정되므로 파라미터 개수는 여기서 검사
+    if (stmtInfo->bindParameterCount != sizeof...(Params))
+    {
+        retValue = Errors::kUnsuccess;
+        return retValue;
+    }
+
+    auto raii = RAIIRegister([&]
+        {
+            sqlite3_clear_bindings(stmtInfo->stmt);
+            sqlite3_reset(stmtInfo->stmt);
+        });
+
+    /*
+        가장 왼쪽의 SQL Parameter Index는 1
+        중괄호 초기화 목록은 왼쪽부터 순서대로 평가됨
+    */
+    int parameterIndex = 1;
+    const int sqliteStatusList[] = { SQLITE_OK, BindParameter_(stmtInfo->stmt, parameterIndex++, params)... };
+    UNREFERENCED_PARAMETER(parameterIndex);
+
+    for (const auto& sqliteStatusListEntry : sqliteStatusList)
+    {
+        if (sqliteStatusListEntry != SQLITE_OK)
+        {
+            retValue = Errors::kUnsuccess;
+            return retValue;
+        }
+    }
+
+    return StepStmt_(*stmtInfo, stmtStepCallback);
+}
+
+template <typename... Params>
+ResultCursor SqliteManager::Query(
+    _In_ StmtHandle preparedStmtHandle,
+    _In_ const Params&... params
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const StmtInfo* stmtInfo = nullptr;
+
+    if (database_ == nullptr)
+    {
+        return ResultCursor(this, nullptr, retValue);
+    }
+
+    retValue = FindPreparedStmt(preparedStmtHandle, stmtInfo);
+    if (retValue != Errors::kSuccess)
+    {
+        return ResultCursor(this, nullptr, retValue);
+    }
+
+    if (stmtInfo->bindParameterCount != sizeof...(Params))
+    {
+        retValue = Errors::kUnsuccess;
+        return ResultCursor(this, nullptr, retValue);
+    }
+
+    int parameterIndex = 1;
+    const int sqliteStatusList[] = { SQLITE_OK, BindParameter_(stmtInfo->stmt, parameterIndex++, params, SQLITE_TRANSIENT)... };
+    UNREFERENCED_PARAMETER(parameterIndex);
+
+    for (const auto& sqliteStatusListEntry : sqliteStatusList)
+    {
+        if (sqliteStatusListEntry != SQLITE_OK)
+        {
+            sqlite3_clear_bindings(stmtInfo->stmt);
+
+            retValue = Errors::kUnsuccess;
+            return ResultCursor(this, nullptr, retValue);
+        }
+    }
+
+    return ResultCursor(this, stmtInfo, Errors::kSuccess);
+}
+
+template <typename Row, typename... Members>
+Errors SqliteManager::BulkInsert(
+    _In_ const TableMapping<Row, Members...>& tableMapping,
+    _In_reads_(rowCount) const Row* rowList,
+    _In_ uint32_t rowCount,
+    _In_opt_ const BulkInsertOptions& bulkInsertOptions /*= BulkInsertOptions()*/,
+    _Out_opt_ uint32_t* insertedRowCount /*= nullptr*/
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    const uint32_t kColumnCount = TableMapping<Row, Members...>::kColumnCount;
+
+    // insertStmtInfoList[n]은 2^n개 행을 INSERT하는 명령문
+    const StmtInfo* insertStmtInfoList[32] = { nullptr, };
+    const StmtInfo* insertStmtInfo = nullptr;
+    uint32_t insertStmtIndex = 0;
+    uint32_t insertStmtRowCount = 0;
+    uint32_t chunkRowCount = bulkInsertOptions.chunkRowCount;
+    uint32_t valuesRowCount = bulkInsertOptions.valuesRowCount;
+    uint32_t maxValuesRowCount = 0;
+
+    bool inCallerTransaction = false;
+    bool inChunkTransaction = false;
+    uint32_t rowIndex = 0;
+    uint32_t chunkEndRowIndex = 0;
+    uint32_t committedRowCount = 0;
+
+    auto raii = RAIIRegister([&]
+        {
+            for (const auto& insertStmtInfoListEntry : insertStmtInfoList)
+            {
+                if (insertStmtInfoListEntry != nullptr)
+                {
+                    sqlite3_clear_bindings(insertStmtInfoListEntry->stmt);
+                    sqlite3_reset(insertStmtInfoListEntry->stmt);
+                }
+            }
+            if (inChunkTransaction == true)
+            {
+                RollbackTransaction();
+            }
+            if (insertedRowCount != nullptr)
+            {
+                *insertedRowCount = committedRowCount;
+            }
+        });
+
+    if (database_ == nullptr)
+    {
+        return retValue;
+    }
+
+    if ((rowList == nullptr) && (rowCount != 0))
+    {
+        return retValue;
+    }
+
+    if (chunkRowCount == 0)
+    {
+        chunkRowCount = rowCount;
+    }
+
+    maxValuesRowCount = static_cast<uint32_t>(sqlite3_limit(database_, SQLITE_LIMIT_VARIABLE_NUMBER, -1)) / kColumnCount;
+    if (valuesRowCount > maxValuesRowCount)
+    {
+        valuesRowCount = maxValuesRowCount;
+    }
+    if (valuesRowCount == 0)
+    {
+        valuesRowCount = 1;
+    }
+    while ((valuesRowCount & (valuesRowCount - 1)) != 0)
+    {
+        valuesRowCount &= valuesRowCount - 1;
+    }
+
+    inCallerTransaction = IsInTransaction();
+
+    while (rowIndex < rowCount)
+    {
+        chunkEndRowIndex = (rowCount - rowIndex < chunkRowCount) ? rowCount : rowIndex + chunkRowCount;
+
+        if (inCallerTransaction == false)
+        {
+            retValue = BeginTransaction(true);
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+            inChunkTransaction = true;
+        }
+
+        while (rowIndex < chunkEndRowIndex)
+        {
+            // 남은 행보다 크지 않은 가장 큰 명령문 선택
+            insertStmtRowCount = valuesRowCount;
+            insertStmtIndex = 0;
+            while (insertStmtRowCount > chunkEndRowIndex - rowIndex)
+            {
+                insertStmtRowCount >>= 1;
+            }
+            while ((1u << insertStmtIndex) < insertStmtRowCount)
+            {
+                insertStmtIndex++;
+            }
+
+            if (insertStmtInfoList[insertStmtIndex] == nullptr)
+            {
+                retValue = AcquirePreparedStmt_(tableMapping.GetInsertStmtString(insertStmtRowCount), insertStmtInfo);
+                if (retValue != Errors::kSuccess)
+                {
+                    return retValue;
+                }
+                insertStmtInfoList[insertStmtIndex] = insertStmtInfo;
+            }
+            insertStmtInfo = insertStmtInfoList[insertStmtIndex];
+
+            // 모든 파라미터를 매번 다시 Bind하므로 sqlite3_clear_bindings는 마지막에 한 번만 호출
+            for (uint32_t insertStmtRowIndex = 0; insertStmtRowIndex < insertStmtRowCount; insertStmtRowIndex++)
+            {
+                if (BindRow_(
+                    insertStmtInfo->stmt,
+                    static_cast<int>(insertStmtRowIndex * kColumnCount + 1),
+                    rowList[rowIndex + insertStmtRowIndex],
+                    tableMapping.GetMemberList(),
+                    std::index_sequence_for<Members...>()) == false)
+                {
+                    retValue = Errors::kUnsuccess;
+                    return retValue;
+                }
+            }
+
+            if (SqliteStep_(*insertStmtInfo) != SQLITE_DONE)
+            {
+                retValue = Errors::kUnsuccess;
+                return retValue;
+            }
+            sqlite3_reset(insertStmtInfo->stmt);
+
+            rowIndex += insertStmtRowCount;
+            if (inCallerTransaction == true)
+            {
+                committedRowCount += insertStmtRowCount;
+            }
+        }
+
+        if (inCallerTransaction == false)
+        {
+            retValue = CommitTransaction();
+            if (retValue != Errors::kSuccess)
+            {
+                return retValue;
+            }
+            inChunkTransaction = false;
+            committedRowCount = chunkEndRowIndex;
+        }
+    }
+
+    retValue = Errors::kSuccess;
+    return retValue;
+}
+
+template <typename Row, typename... Members>
+Errors SqliteManager::BulkInsert(
+    _In_ const TableMapping<Row, Members...>& tableMapping,
+    _In_ const std::vector<Row>& rowList,
+    _In_opt_ const BulkInsertOptions& bulkInsertOptions /*= BulkInsertOptions()*/,
+    _Out_opt_ uint32_t* insertedRowCount /*= nullptr*/
+)
+{
+    return BulkInsert(tableMapping, rowList.data(), static_cast<uint32_t>(rowList.size()), bulkInsertOptions, insertedRowCount);
+}
+
+template <typename StepCallback>
+Errors SqliteManager::StepStmt_(
+    _In_ const StmtInfo& stmtInfo,
+    _In_opt_ StepCallback& stmtStepCallback
+)
+{
+    Errors retValue = Errors::kUnsuccess;
+
+    int sqliteStatus = SQLITE_ERROR;
+    uint32_t stepCount = 0;
+    CallbackErrors callbackStatus;
+
+    sqliteStatus = SqliteStep_(stmtInfo);
+    stepCount++;
+
+    do
+    {
+        if (sqliteStatus == SQLITE_ROW)
+        {
+            callbackStatus = InvokeStepCallback_(stmtStepCallback, stmtInfo);
+            if (callbackStatus == CallbackErrors::kStop)
+            {
+                retValue = Errors::kStopCallback;
+                break;
+            }
+            else if (callbackStatus == CallbackErrors::kFail)
+            {
+                retValue = Errors::kFailCallback;
+                break;
+            }
+        }
+        else if (sqliteStatus == SQLITE_DONE)
+        {
+            if ((stmtInfo.stmtType == StmtType::kSelect) && (stepCount == 1))
+            {
+                retValue = Errors::kNoResult;
+            }
+            else
+            {
+                retValue = Errors::kSuccess;
+            }
+
+            break;
+        }
+        else
+        {
+            retValue = Errors::kUnsuccess;
+            break;
+        }
+
+        sqliteStatus = SqliteStep_(stmtInfo);
+        stepCount++;
+
+    } while (true);
+
+    return retValue;
+}
+
 } // namespace EzSqlite
\ No newline at end of file